@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -29,6 +29,12 @@
  *      In this configuration MEM0 represents the RAM region attached to the
  *      instruction bus and MEM1 represents the RAM region attached to the data
  *      bus.
+ *
+ * In any layout, the hot code and data sections (see FWK_HOT and FWK_HOT_DATA)
+ * can be placed in tightly coupled memories by defining FMW_ITCM_BASE and
+ * FMW_ITCM_SIZE, and FMW_DTCM_BASE and FMW_DTCM_SIZE respectively. They are
+ * loaded with the rest of the image and copied to the TCMs during the C runtime
+ * initialization. The TCMs must be enabled by the time the C runtime starts.
  */
 
 #ifndef ARCH_SCATTER_H
@@ -72,4 +78,12 @@
 #    define ARCH_MEM1_LIMIT (FMW_MEM1_BASE + FMW_MEM1_SIZE)
 #endif
 
+#if defined(FMW_ITCM_BASE) && !defined(FMW_ITCM_SIZE)
+#    error "FMW_ITCM_SIZE has not been configured"
+#endif
+
+#if defined(FMW_DTCM_BASE) && !defined(FMW_DTCM_SIZE)
+#    error "FMW_DTCM_SIZE has not been configured"
+#endif
+
 #endif /* ARCH_SCATTER_H */
@@ -114,6 +114,13 @@ static const char *const secure_fault_errors[] = {
         */
 
 #ifdef __NEWLIB__
+static void load_section(char *load, char *start, char *end)
+{
+    if (load != start) {
+        (void)memcpy(start, load, (size_t)(end - start));
+    }
+}
+
 /*
  * This function overloads a weak definition provided by Newlib. It is called
  * during initialization of the C runtime just after .bss has been zeroed.
@@ -124,13 +131,19 @@ void software_init_hook(void)
     extern char __data_start__;
     extern char __data_end__;
 
-    char *load = &__data_load__;
-    char *start = &__data_start__;
-    char *end = &__data_end__;
+    extern char __itcm_load__;
+    extern char __itcm_start__;
+    extern char __itcm_end__;
 
-    if (load != start) {
-        (void)memcpy(start, load, (size_t)(end - start));
-    }
+    extern char __dtcm_load__;
+    extern char __dtcm_start__;
+    extern char __dtcm_end__;
+
+    load_section(&__data_load__, &__data_start__, &__data_end__);
+
+    /* Hot code and data placed in the TCMs, empty without TCMs */
+    load_section(&__itcm_load__, &__itcm_start__, &__itcm_end__);
+    load_section(&__dtcm_load__, &__dtcm_start__, &__dtcm_end__);
 }
 #endif
 
@@ -148,6 +148,48 @@ static int clear_pending(unsigned int interrupt)
     return FWK_SUCCESS;
 }
 
+static int set_priority(unsigned int interrupt, unsigned int priority)
+{
+    if ((interrupt >= irq_count) || (priority >= (1U << __NVIC_PRIO_BITS))) {
+        return FWK_E_PARAM;
+    }
+
+    NVIC_SetPriority((enum IRQn)interrupt, priority);
+
+    return FWK_SUCCESS;
+}
+
+static int get_priority(unsigned int interrupt, unsigned int *priority)
+{
+    if (interrupt >= irq_count) {
+        return FWK_E_PARAM;
+    }
+
+    *priority = NVIC_GetPriority((enum IRQn)interrupt);
+
+    return FWK_SUCCESS;
+}
+
+#ifndef ARMV6M
+static int set_priority_grouping(unsigned int grouping)
+{
+    /* PRIGROUP is a 3-bit field of the AIRCR register */
+    if (grouping > 7U) {
+        return FWK_E_PARAM;
+    }
+
+    NVIC_SetPriorityGrouping(grouping);
+
+    return FWK_SUCCESS;
+}
+#else
+static int set_priority_grouping(unsigned int grouping)
+{
+    /* ARMv6-M only implements preemption priorities */
+    return FWK_E_SUPPORT;
+}
+#endif
+
 static int set_isr_irq(unsigned int interrupt, void (*isr)(void))
 {
     if (interrupt >= irq_count) {
@@ -254,6 +296,9 @@ static const struct fwk_arch_interrupt_driver arch_nvic_driver = {
     .set_isr_fault = set_isr_fault,
     .get_current = get_current,
     .is_interrupt_context = is_interrupt_context,
+    .set_priority = set_priority,
+    .get_priority = get_priority,
+    .set_priority_grouping = set_priority_grouping,
 };
 
 static void irq_invalid(void)
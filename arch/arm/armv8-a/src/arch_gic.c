@@ -28,8 +28,12 @@
 #    define IS_SUPPORT_INT(n) ((n >= SMCMH_IRQ_START) && (n < SMCMH_IRQ_END))
 #    define EFECTIVE_NO(n) (n & 0xff)
 #endif /* RCAR_SCMI_LIB */
-#define CHECK_BIT(d, b) ((d >> b) & 1)
-#define IID_LEN (10)
+
+/* Number of interrupts covered by a block of the callback table */
+#define ISR_BLOCK_SHIFT 5
+#define ISR_BLOCK_SIZE (1U << ISR_BLOCK_SHIFT)
+#define ISR_BLOCK_MASK (ISR_BLOCK_SIZE - 1U)
+#define ISR_BLOCK_COUNT ((MAX_IRQ + ISR_BLOCK_MASK) >> ISR_BLOCK_SHIFT)
 
 /*
  * For interrupts with parameters, their entry in the vector table points to a
@@ -45,100 +49,53 @@ struct callback {
     uintptr_t param;
 };
 
-struct r_node {
-    int valid;
-    struct r_node *left;
-    struct r_node *right;
-    struct callback *entry;
-};
-
-struct r_tree {
-    struct r_node *root;
-    int _allocated;
-};
-
 static unsigned int c_interrupt;
-static struct r_tree *radix;
 
-struct r_tree *init_entry(struct r_tree *rt)
-{
-    if (NULL == rt) {
-        rt = fwk_mm_calloc(1, sizeof(struct r_tree));
-        if (NULL == rt) {
-            return NULL;
-        }
-        rt->_allocated = 1;
-    } else {
-        rt->_allocated = 0;
-    }
-    rt->root = NULL;
-
-    return rt;
-}
+/*
+ * The callbacks are held in a two-level table indexed by interrupt ID, the
+ * first level pointing to blocks of ISR_BLOCK_SIZE consecutive interrupts.
+ * Blocks are only allocated once one of their interrupts is registered, which
+ * keeps sparse interrupt ranges cheap while resolving an interrupt in
+ * irq_global() in constant time.
+ */
+static struct callback *isr_table[ISR_BLOCK_COUNT];
 
-static void *_lookup(
-    struct r_node *cur,
-    struct r_node *cand,
-    uint32_t iid,
-    int bitno)
+static struct callback *lookup_entry(uint32_t iid)
 {
-    if (NULL == cur) {
-        return NULL != cand ? cand->entry : NULL;
-    }
+    struct callback *block;
 
-    if (cur->valid) {
-        cand = cur;
+    if (iid >= (uint32_t)MAX_IRQ) {
+        return NULL;
     }
 
-    if (CHECK_BIT(iid, bitno)) {
-        return _lookup(cur->right, cand, iid, bitno + 1);
-    } else {
-        return _lookup(cur->left, cand, iid, bitno + 1);
+    block = isr_table[iid >> ISR_BLOCK_SHIFT];
+    if (block == NULL) {
+        return NULL;
     }
-}
 
-static void *lookup_entry(struct r_tree *rt, uint32_t iid)
-{
-    return _lookup(rt->root, NULL, iid, 0);
+    return &block[iid & ISR_BLOCK_MASK];
 }
 
-static int _add(
-    struct r_node **cur,
-    uint32_t iid,
-    void *entry,
-    int bitsize,
-    int bitno)
+static int add_entry(uint32_t iid, struct callback **entry)
 {
-    struct r_node *new;
+    struct callback **block;
 
-    if (NULL == *cur) {
-        new = fwk_mm_calloc(1, sizeof(struct r_node));
-        if (NULL == new) {
-            return -1;
+    block = &isr_table[iid >> ISR_BLOCK_SHIFT];
+    if (*block == NULL) {
+        *block = fwk_mm_calloc(ISR_BLOCK_SIZE, sizeof(struct callback));
+        if (*block == NULL) {
+            return FWK_E_NOMEM;
         }
-        memset(new, 0, sizeof(struct r_node));
-        *cur = new;
     }
 
-    if (bitsize == bitno) {
-        if ((*cur)->valid) {
-            return -1;
-        }
-        (*cur)->valid = 1;
-        (*cur)->entry = entry;
-        return 0;
-    } else {
-        if (CHECK_BIT(iid, bitno)) {
-            return _add(&(*cur)->right, iid, entry, bitsize, bitno + 1);
-        } else {
-            return _add(&(*cur)->left, iid, entry, bitsize, bitno + 1);
-        }
+    *entry = &(*block)[iid & ISR_BLOCK_MASK];
+
+    /* Only one callback may be registered per interrupt */
+    if ((*entry)->func != NULL) {
+        return FWK_E_BUSY;
     }
-}
 
-static int add_entry(struct r_tree *rt, uint32_t iid, void *entry, int len)
-{
-    return _add(&rt->root, iid, entry, len, 0);
+    return FWK_SUCCESS;
 }
 
 void irq_global(uint32_t iid)
@@ -147,7 +104,7 @@ void irq_global(uint32_t iid)
 
     c_interrupt = iid;
 
-    entry = (struct callback *)lookup_entry(radix, iid);
+    entry = lookup_entry(iid);
     if (entry != NULL) {
         if (entry->func) {
             /* Available callback Function */
@@ -487,20 +444,21 @@ static int clear_pending(unsigned int interrupt)
 static int set_isr_irq(unsigned int interrupt, void (*isr)(void))
 {
     struct callback *entry;
-    int ret;
+    int status;
 
     if ((MIN_IRQ > interrupt) || (MAX_IRQ <= interrupt))
         return FWK_E_PARAM;
 
-    entry = fwk_mm_calloc(1, sizeof(struct callback));
-    if (NULL == entry)
+    status = add_entry(interrupt, &entry);
+    if (status == FWK_E_NOMEM)
+        return status;
+
+    /* The interrupt already has a callback */
+    if (status != FWK_SUCCESS)
         return FWK_E_PANIC;
 
     entry->funcn = isr;
     entry->param = (uintptr_t)NULL;
-    ret = add_entry(radix, interrupt, (void *)entry, IID_LEN);
-    if (ret)
-        return FWK_E_PANIC;
 
     return FWK_SUCCESS;
 }
@@ -511,20 +469,21 @@ static int set_isr_irq_param(
     uintptr_t parameter)
 {
     struct callback *entry;
-    int ret;
+    int status;
 
     if ((MIN_IRQ > interrupt) || (MAX_IRQ <= interrupt))
         return FWK_E_PANIC;
 
-    entry = fwk_mm_calloc(1, sizeof(struct callback));
-    if (NULL == entry)
-        return FWK_E_PANIC;
+    status = add_entry(interrupt, &entry);
+    if (status == FWK_E_NOMEM)
+        return status;
+
+    /* The interrupt already has a callback */
+    if (status != FWK_SUCCESS)
+        return FWK_E_PARAM;
 
     entry->func = isr;
     entry->param = parameter;
-    ret = add_entry(radix, interrupt, (void *)entry, IID_LEN);
-    if (ret)
-        return FWK_E_PARAM;
 
     return FWK_SUCCESS;
 }
@@ -582,14 +541,6 @@ static const struct fwk_arch_interrupt_driver arm_gic_driver = {
 
 int arm_gic_init(const struct fwk_arch_interrupt_driver **driver)
 {
-    /*
-     * Allocate and initialize a table for the callback functions and their
-     * corresponding parameters.
-     */
-    radix = init_entry(NULL);
-    if (radix == NULL)
-        return FWK_E_NOMEM;
-
     gic_init();
 
     /*
@@ -0,0 +1,40 @@
+#
+# Arm SCP/MCP Software
+# Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+include_guard()
+
+# .rst:
+#
+# .. command:: scp_target_optimization
+#
+# Overrides the optimization level of a target with `SCP_OPTIMIZATION_<tag>`,
+# if set.
+#
+# .. cmake:: scp_target_optimization(<target> <tag>)
+#
+# The level is one of `-O0`, `-O1`, `-O2`, `-O3`, `-Os`, `-Oz` or `-Og`. It is
+# added after the flags of the build type, which it takes precedence over, e.g.
+# to build the latency critical modules for speed in a firmware otherwise built
+# for size.
+#
+function(scp_target_optimization target tag)
+    set(level "${SCP_OPTIMIZATION_${tag}}")
+
+    if("${level}" STREQUAL "")
+        return()
+    endif()
+
+    set(levels "-O0" "-O1" "-O2" "-O3" "-Os" "-Oz" "-Og")
+
+    if(NOT level IN_LIST levels)
+        message(FATAL_ERROR
+            "Invalid optimization level for `SCP_OPTIMIZATION_${tag}`: "
+            "${level}")
+    endif()
+
+    target_compile_options(${target} PRIVATE "${level}")
+endfunction()
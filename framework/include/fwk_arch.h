@@ -186,6 +186,46 @@ struct fwk_arch_interrupt_driver {
      * \retval false not in an interrupt context.
      */
     bool (*is_interrupt_context)(void);
+
+    /*!
+     * \brief Set the priority of an interrupt (optional).
+     *
+     * \details Lower values denote higher priorities. The number of priority
+     *      levels is architecture-specific.
+     *
+     * \param interrupt Interrupt number.
+     * \param priority Priority level.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     */
+    int (*set_priority)(unsigned int interrupt, unsigned int priority);
+
+    /*!
+     * \brief Get the priority of an interrupt (optional).
+     *
+     * \param interrupt Interrupt number.
+     * \param [out] priority Priority level.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     */
+    int (*get_priority)(unsigned int interrupt, unsigned int *priority);
+
+    /*!
+     * \brief Set the priority grouping (optional).
+     *
+     * \details The priority grouping selects how many bits of the priority
+     *      levels are used for preemption, the remaining ones only ordering
+     *      pending interrupts. Its encoding is architecture-specific.
+     *
+     * \param grouping Priority grouping.
+     *
+     * \retval ::FWK_SUCCESS Operation succeeded.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     * \retval ::FWK_E_SUPPORT Priority grouping is not supported.
+     */
+    int (*set_priority_grouping)(unsigned int grouping);
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -262,6 +262,41 @@
 #    define FWK_SECTION(SECTION) __attribute__((__section__(SECTION)))
 #endif
 
+/*!
+ * \def FWK_HOT
+ *
+ * \brief "Hot code" attribute.
+ *
+ * \details Places the function that this attribute is attached to into the
+ *      hot code section, for the functions on the latency critical paths, e.g.
+ *      the event loop and the message interrupts. Firmware may map this
+ *      section to a faster memory by defining \c FMW_ITCM_BASE and
+ *      \c FMW_ITCM_SIZE, otherwise it is placed with the rest of the code.
+ */
+
+/*!
+ * \def FWK_HOT_DATA
+ *
+ * \brief "Hot data" attribute.
+ *
+ * \details Places the writable variable that this attribute is attached to
+ *      into the hot data section. Firmware may map this section to a faster
+ *      memory by defining \c FMW_DTCM_BASE and \c FMW_DTCM_SIZE, otherwise
+ *      it is placed with the rest of the data.
+ *
+ * \note The hot data section is an initialized data section, stored in the
+ *      firmware image. Only attach this attribute to initialized variables, as
+ *      a zero-initialized variable would move from \c .bss into the image.
+ */
+
+#ifdef FWK_SECTION
+#    define FWK_HOT FWK_SECTION(".text.fwk_hot")
+#    define FWK_HOT_DATA FWK_SECTION(".data.fwk_hot")
+#else
+#    define FWK_HOT
+#    define FWK_HOT_DATA
+#endif
+
 /*!
  * \def FWK_DEPRECATED
  *
@@ -192,6 +192,47 @@ int fwk_interrupt_set_isr_param(unsigned int interrupt,
                                 void (*isr)(uintptr_t param),
                                 uintptr_t param);
 
+/*!
+ * \brief Set the priority of an interrupt.
+ *
+ * \details Lower values denote higher priorities. An interrupt may preempt the
+ *      service routine of an interrupt with a lower priority.
+ *
+ * \param interrupt Interrupt number.
+ * \param priority Priority level.
+ *
+ * \retval ::FWK_SUCCESS Operation succeeded.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ * \retval ::FWK_E_SUPPORT Interrupt priorities are not supported.
+ * \retval ::FWK_E_INIT The component has not been initialized.
+ */
+int fwk_interrupt_set_priority(unsigned int interrupt, unsigned int priority);
+
+/*!
+ * \brief Get the priority of an interrupt.
+ *
+ * \param interrupt Interrupt number.
+ * \param [out] priority Priority level.
+ *
+ * \retval ::FWK_SUCCESS Operation succeeded.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ * \retval ::FWK_E_SUPPORT Interrupt priorities are not supported.
+ * \retval ::FWK_E_INIT The component has not been initialized.
+ */
+int fwk_interrupt_get_priority(unsigned int interrupt, unsigned int *priority);
+
+/*!
+ * \brief Set the interrupt priority grouping.
+ *
+ * \param grouping Architecture-specific priority grouping.
+ *
+ * \retval ::FWK_SUCCESS Operation succeeded.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ * \retval ::FWK_E_SUPPORT Priority grouping is not supported.
+ * \retval ::FWK_E_INIT The component has not been initialized.
+ */
+int fwk_interrupt_set_priority_grouping(unsigned int grouping);
+
 /*!
  * \brief Get the interrupt number for the interrupt service routine being
  *      processed.
@@ -0,0 +1,181 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FWK_MMIO_H
+#define FWK_MMIO_H
+
+#include <fwk_id.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupLibFramework
+ * \defgroup GroupMmio Register accesses
+ *
+ * \details This component provides accessors for the memory-mapped registers.
+ *      By default, they are plain volatile accesses. When
+ *      \c FWK_MMIO_TRACE_ENABLE is defined, e.g. through the
+ *      `SCP_ENABLE_MMIO_TRACING` build option, the accesses are counted for
+ *      the module performing them and are passed to the firmware MMIO driver,
+ *      if any, which may trace them or back the registers with a simulated
+ *      memory.
+ *
+ * \{
+ */
+
+/*!
+ * \brief Index of the module accessing the registers, as set by the build
+ *      system for each module when the accesses are traced.
+ */
+#ifndef FWK_MMIO_MODULE_IDX
+#    define FWK_MMIO_MODULE_IDX FWK_MMIO_MODULE_IDX_NONE
+#endif
+
+/*!
+ * \brief Module index of the accesses performed outside the modules, e.g. by
+ *      the architecture or the firmware.
+ */
+#define FWK_MMIO_MODULE_IDX_NONE UINT32_MAX
+
+#ifdef FWK_MMIO_TRACE_ENABLE
+/*!
+ * \brief Read a 32-bit register.
+ *
+ * \param[in] ADDR Address of the register.
+ *
+ * \return Value of the register.
+ */
+#    define FWK_MMIO_READ32(ADDR) \
+        fwk_mmio_read32(FWK_MMIO_MODULE_IDX, (volatile const void *)(ADDR))
+
+/*!
+ * \brief Write a 32-bit register.
+ *
+ * \param[in] ADDR Address of the register.
+ * \param[in] VALUE Value to write.
+ */
+#    define FWK_MMIO_WRITE32(ADDR, VALUE) \
+        fwk_mmio_write32( \
+            FWK_MMIO_MODULE_IDX, (volatile void *)(ADDR), (VALUE))
+#else
+#    define FWK_MMIO_READ32(ADDR) (*(volatile const uint32_t *)(ADDR))
+
+#    define FWK_MMIO_WRITE32(ADDR, VALUE) \
+        ((void)(*(volatile uint32_t *)(ADDR) = (VALUE)))
+#endif
+
+/*!
+ * \brief Register access counts.
+ */
+struct fwk_mmio_count {
+    /*! Number of register reads. */
+    uint32_t read_count;
+
+    /*! Number of register writes. */
+    uint32_t write_count;
+};
+
+/*!
+ * \brief MMIO driver.
+ *
+ * \details All the members are optional.
+ */
+struct fwk_mmio_driver {
+    /*!
+     * \brief Read a 32-bit register, e.g. from a simulated memory.
+     *
+     * \param[in] addr Address of the register.
+     *
+     * \return Value of the register.
+     */
+    uint32_t (*read32)(volatile const void *addr);
+
+    /*!
+     * \brief Write a 32-bit register, e.g. to a simulated memory.
+     *
+     * \param[in] addr Address of the register.
+     * \param[in] value Value to write.
+     */
+    void (*write32)(volatile void *addr, uint32_t value);
+
+    /*!
+     * \brief Report a register access, e.g. to a trace buffer.
+     *
+     * \param[in] module_idx Index of the module performing the access, or
+     *      ::FWK_MMIO_MODULE_IDX_NONE.
+     * \param[in] addr Address of the register.
+     * \param[in] value Value read or written.
+     * \param[in] write \c true for a write, \c false for a read.
+     */
+    void (*report_access)(
+        uint32_t module_idx,
+        volatile const void *addr,
+        uint32_t value,
+        bool write);
+};
+
+/*!
+ * \brief Initialize the register access tracing.
+ *
+ * \note This function has the constructor attribute, which adds it to the list
+ *      of functions executed before `main`.
+ */
+void fwk_mmio_init(void);
+
+/*!
+ * \brief Read a 32-bit register and account for the access.
+ *
+ * \param[in] module_idx Index of the module performing the access.
+ * \param[in] addr Address of the register.
+ *
+ * \return Value of the register.
+ */
+uint32_t fwk_mmio_read32(uint32_t module_idx, volatile const void *addr);
+
+/*!
+ * \brief Write a 32-bit register and account for the access.
+ *
+ * \param[in] module_idx Index of the module performing the access.
+ * \param[in] addr Address of the register.
+ * \param[in] value Value to write.
+ */
+void fwk_mmio_write32(uint32_t module_idx, volatile void *addr, uint32_t value);
+
+/*!
+ * \brief Get the register access counts of a module.
+ *
+ * \param[in] id Module identifier, or ::FWK_ID_NONE for the accesses
+ *      performed outside the modules.
+ * \param[out] count Register access counts.
+ *
+ * \retval ::FWK_SUCCESS The counts were returned.
+ * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+ */
+int fwk_mmio_get_count(fwk_id_t id, struct fwk_mmio_count *count);
+
+/*!
+ * \brief Reset the register access counts of all the modules.
+ */
+void fwk_mmio_reset_count(void);
+
+/*!
+ * \brief Register a framework MMIO driver.
+ *
+ * \details This is a weak function provided by the framework that, by default,
+ *      does not register a driver, and should be overridden by the firmware if
+ *      you wish to provide one.
+ *
+ * \return Framework MMIO driver.
+ */
+struct fwk_mmio_driver fmw_mmio_driver(void);
+
+/*!
+ * \}
+ */
+
+#endif /* FWK_MMIO_H */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -14,6 +14,7 @@
 #include <internal/fwk_module.h>
 
 #include <fwk_assert.h>
+#include <fwk_attributes.h>
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
@@ -101,7 +102,7 @@ static struct fwk_event *duplicate_event(
     return allocated_event;
 }
 
-static int put_event(
+static FWK_HOT int put_event(
     void *event,
     enum interrupt_states intr_state,
     enum fwk_event_type event_type)
@@ -185,7 +186,7 @@ static void free_event(struct fwk_event *event)
     (void)fwk_interrupt_global_enable(flags);
 }
 
-static void process_next_event(void)
+static FWK_HOT void process_next_event(void)
 {
     int status;
     struct fwk_event *event, *allocated_event, async_response_event;
@@ -253,7 +254,7 @@ static void process_next_event(void)
     return;
 }
 
-static bool process_isr(void)
+static FWK_HOT bool process_isr(void)
 {
     struct fwk_event *isr_event;
     unsigned int flags;
@@ -306,7 +307,7 @@ int __fwk_init(size_t event_count)
     return FWK_SUCCESS;
 }
 
-void fwk_process_event_queue(void)
+FWK_HOT void fwk_process_event_queue(void)
 {
     for (;;) {
         while (!fwk_list_is_empty(&ctx.event_queue)) {
@@ -353,7 +354,7 @@ int __fwk_put_notification(struct fwk_event *event)
  * Public interface functions
  */
 
-int __fwk_put_event(struct fwk_event *event)
+FWK_HOT int __fwk_put_event(struct fwk_event *event)
 {
     int status = FWK_E_PARAM;
     enum interrupt_states intr_state;
@@ -425,7 +426,7 @@ error:
     return status;
 }
 
-int __fwk_put_event_light(struct fwk_event_light *event)
+FWK_HOT int __fwk_put_event_light(struct fwk_event_light *event)
 {
     int status = FWK_E_PARAM;
     enum interrupt_states intr_state;
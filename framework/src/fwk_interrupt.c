@@ -173,6 +173,49 @@ int fwk_interrupt_set_isr_param(unsigned int interrupt,
     }
 }
 
+int fwk_interrupt_set_priority(unsigned int interrupt, unsigned int priority)
+{
+    if (!initialized) {
+        return FWK_E_INIT;
+    }
+
+    if (fwk_interrupt_driver->set_priority == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    return fwk_interrupt_driver->set_priority(interrupt, priority);
+}
+
+int fwk_interrupt_get_priority(unsigned int interrupt, unsigned int *priority)
+{
+    if (!initialized) {
+        return FWK_E_INIT;
+    }
+
+    if (priority == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (fwk_interrupt_driver->get_priority == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    return fwk_interrupt_driver->get_priority(interrupt, priority);
+}
+
+int fwk_interrupt_set_priority_grouping(unsigned int grouping)
+{
+    if (!initialized) {
+        return FWK_E_INIT;
+    }
+
+    if (fwk_interrupt_driver->set_priority_grouping == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    return fwk_interrupt_driver->set_priority_grouping(grouping);
+}
+
 int fwk_interrupt_get_current(unsigned int *interrupt)
 {
     if (!initialized) {
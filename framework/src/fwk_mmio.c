@@ -0,0 +1,124 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_attributes.h>
+#include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_mmio.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_string.h>
+
+#include <stddef.h>
+
+static struct {
+    struct fwk_mmio_driver driver;
+
+    /* Access counts per module, the last entry is for the other accesses */
+    struct fwk_mmio_count count[FWK_MODULE_IDX_COUNT + 1];
+} fwk_mmio_ctx;
+
+static struct fwk_mmio_count *get_count(uint32_t module_idx)
+{
+    if (module_idx >= (uint32_t)FWK_MODULE_IDX_COUNT) {
+        return &fwk_mmio_ctx.count[FWK_MODULE_IDX_COUNT];
+    }
+
+    return &fwk_mmio_ctx.count[module_idx];
+}
+
+FWK_CONSTRUCTOR void fwk_mmio_init(void)
+{
+    struct fwk_mmio_driver driver = fmw_mmio_driver();
+
+    (void)fwk_str_memcpy(&fwk_mmio_ctx.driver, &driver, sizeof(driver));
+}
+
+uint32_t fwk_mmio_read32(uint32_t module_idx, volatile const void *addr)
+{
+    uint32_t value;
+    unsigned int flags;
+
+    if (fwk_mmio_ctx.driver.read32 != NULL) {
+        value = fwk_mmio_ctx.driver.read32(addr);
+    } else {
+        value = *(volatile const uint32_t *)addr;
+    }
+
+    flags = fwk_interrupt_global_disable();
+    get_count(module_idx)->read_count++;
+    (void)fwk_interrupt_global_enable(flags);
+
+    if (fwk_mmio_ctx.driver.report_access != NULL) {
+        fwk_mmio_ctx.driver.report_access(module_idx, addr, value, false);
+    }
+
+    return value;
+}
+
+void fwk_mmio_write32(uint32_t module_idx, volatile void *addr, uint32_t value)
+{
+    unsigned int flags;
+
+    if (fwk_mmio_ctx.driver.write32 != NULL) {
+        fwk_mmio_ctx.driver.write32(addr, value);
+    } else {
+        *(volatile uint32_t *)addr = value;
+    }
+
+    flags = fwk_interrupt_global_disable();
+    get_count(module_idx)->write_count++;
+    (void)fwk_interrupt_global_enable(flags);
+
+    if (fwk_mmio_ctx.driver.report_access != NULL) {
+        fwk_mmio_ctx.driver.report_access(module_idx, addr, value, true);
+    }
+}
+
+int fwk_mmio_get_count(fwk_id_t id, struct fwk_mmio_count *count)
+{
+    uint32_t module_idx;
+    unsigned int flags;
+
+    if (count == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (fwk_id_is_equal(id, FWK_ID_NONE)) {
+        module_idx = FWK_MMIO_MODULE_IDX_NONE;
+    } else if (
+        fwk_id_is_type(id, FWK_ID_TYPE_MODULE) &&
+        (fwk_id_get_module_idx(id) < (unsigned int)FWK_MODULE_IDX_COUNT)) {
+        module_idx = fwk_id_get_module_idx(id);
+    } else {
+        return FWK_E_PARAM;
+    }
+
+    flags = fwk_interrupt_global_disable();
+    *count = *get_count(module_idx);
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
+void fwk_mmio_reset_count(void)
+{
+    unsigned int flags;
+
+    flags = fwk_interrupt_global_disable();
+    fwk_str_memset(fwk_mmio_ctx.count, 0, sizeof(fwk_mmio_ctx.count));
+    (void)fwk_interrupt_global_enable(flags);
+}
+
+FWK_WEAK struct fwk_mmio_driver fmw_mmio_driver(void)
+{
+    return (struct fwk_mmio_driver){
+        .read32 = NULL,
+        .write32 = NULL,
+        .report_access = NULL,
+    };
+}
@@ -33,6 +33,9 @@ static int set_isr_nmi_return_val;
 static int set_isr_nmi_param_return_val;
 static int set_isr_fault_return_val;
 static int get_current_return_val;
+static int set_priority_return_val;
+static int get_priority_return_val;
+static int set_priority_grouping_return_val;
 
 static void fake_isr(void)
 {
@@ -121,6 +124,21 @@ static bool is_interrupt_context(void)
     return (get_current_return_val == FWK_SUCCESS);
 }
 
+static int set_priority(unsigned int interrupt, unsigned int priority)
+{
+    return set_priority_return_val;
+}
+
+static int get_priority(unsigned int interrupt, unsigned int *priority)
+{
+    return get_priority_return_val;
+}
+
+static int set_priority_grouping(unsigned int grouping)
+{
+    return set_priority_grouping_return_val;
+}
+
 static const struct fwk_arch_interrupt_driver driver = {
     .global_enable = global_enable,
     .global_disable = global_disable,
@@ -137,6 +155,28 @@ static const struct fwk_arch_interrupt_driver driver = {
     .set_isr_fault = set_isr_fault,
     .get_current = get_current,
     .is_interrupt_context = is_interrupt_context,
+    .set_priority = set_priority,
+    .get_priority = get_priority,
+    .set_priority_grouping = set_priority_grouping,
+};
+
+/* Driver without the optional priority functions */
+static const struct fwk_arch_interrupt_driver driver_no_priority = {
+    .global_enable = global_enable,
+    .global_disable = global_disable,
+    .is_enabled = is_enabled,
+    .enable = enable,
+    .disable = disable,
+    .is_pending = is_pending,
+    .set_pending = set_pending,
+    .clear_pending = clear_pending,
+    .set_isr_irq = set_isr,
+    .set_isr_irq_param = set_isr_param,
+    .set_isr_nmi = set_isr_nmi,
+    .set_isr_nmi_param = set_isr_nmi_param,
+    .set_isr_fault = set_isr_fault,
+    .get_current = get_current,
+    .is_interrupt_context = is_interrupt_context,
 };
 
 static const struct fwk_arch_interrupt_driver driver_invalid = {};
@@ -155,6 +195,9 @@ static void test_case_setup(void)
     set_isr_nmi_param_return_val = FWK_E_HANDLER;
     set_isr_fault_return_val = FWK_E_HANDLER;
     get_current_return_val = FWK_E_HANDLER;
+    set_priority_return_val = FWK_E_HANDLER;
+    get_priority_return_val = FWK_E_HANDLER;
+    set_priority_grouping_return_val = FWK_E_HANDLER;
 }
 
 static void test_fwk_interrupt_before_init(void)
@@ -193,6 +236,15 @@ static void test_fwk_interrupt_before_init(void)
     result = fwk_interrupt_get_current(&interrupt);
     assert(result == FWK_E_INIT);
 
+    result = fwk_interrupt_set_priority(interrupt, 0);
+    assert(result == FWK_E_INIT);
+
+    result = fwk_interrupt_get_priority(interrupt, &interrupt);
+    assert(result == FWK_E_INIT);
+
+    result = fwk_interrupt_set_priority_grouping(0);
+    assert(result == FWK_E_INIT);
+
     state = fwk_is_interrupt_context();
     assert(state == false);
 }
@@ -344,6 +396,58 @@ static void test_fwk_interrupt_get_current(void)
     assert(result == FWK_SUCCESS);
 }
 
+static void test_fwk_interrupt_set_priority(void)
+{
+    int result;
+
+    set_priority_return_val = FWK_SUCCESS;
+    result = fwk_interrupt_set_priority(INTERRUPT_ID, 1);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_fwk_interrupt_get_priority(void)
+{
+    int result;
+    unsigned int priority;
+
+    result = fwk_interrupt_get_priority(INTERRUPT_ID, NULL);
+    assert(result == FWK_E_PARAM);
+
+    get_priority_return_val = FWK_SUCCESS;
+    result = fwk_interrupt_get_priority(INTERRUPT_ID, &priority);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_fwk_interrupt_set_priority_grouping(void)
+{
+    int result;
+
+    set_priority_grouping_return_val = FWK_SUCCESS;
+    result = fwk_interrupt_set_priority_grouping(3);
+    assert(result == FWK_SUCCESS);
+}
+
+static void test_fwk_interrupt_priority_not_supported(void)
+{
+    int result;
+    unsigned int priority;
+
+    result = fwk_interrupt_init(&driver_no_priority);
+    assert(result == FWK_SUCCESS);
+
+    result = fwk_interrupt_set_priority(INTERRUPT_ID, 1);
+    assert(result == FWK_E_SUPPORT);
+
+    result = fwk_interrupt_get_priority(INTERRUPT_ID, &priority);
+    assert(result == FWK_E_SUPPORT);
+
+    result = fwk_interrupt_set_priority_grouping(3);
+    assert(result == FWK_E_SUPPORT);
+
+    result = fwk_interrupt_init(&driver);
+    assert(result == FWK_SUCCESS);
+}
+
 static void test_fwk_interrupt_nested_critical_section(void)
 {
     unsigned int flags1, flags2, flags3;
@@ -380,6 +484,10 @@ static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_fwk_interrupt_set_isr_param),
     FWK_TEST_CASE(test_fwk_interrupt_set_isr_fault),
     FWK_TEST_CASE(test_fwk_interrupt_get_current),
+    FWK_TEST_CASE(test_fwk_interrupt_set_priority),
+    FWK_TEST_CASE(test_fwk_interrupt_get_priority),
+    FWK_TEST_CASE(test_fwk_interrupt_set_priority_grouping),
+    FWK_TEST_CASE(test_fwk_interrupt_priority_not_supported),
     FWK_TEST_CASE(test_fwk_interrupt_nested_critical_section),
 };
 
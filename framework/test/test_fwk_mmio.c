@@ -0,0 +1,216 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define FWK_MMIO_TRACE_ENABLE
+#define FWK_MMIO_MODULE_IDX FWK_MODULE_IDX_TEST1
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_mmio.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define REG_COUNT (4)
+
+static uint32_t registers[REG_COUNT];
+static uint32_t simulated_registers[REG_COUNT];
+
+static unsigned int report_count;
+static uint32_t last_module_idx;
+static volatile const void *last_addr;
+static uint32_t last_value;
+static bool last_write;
+
+static uint32_t simulated_read32(volatile const void *addr)
+{
+    size_t idx = (size_t)((const uint32_t *)addr - registers);
+
+    assert(idx < REG_COUNT);
+
+    return simulated_registers[idx];
+}
+
+static void simulated_write32(volatile void *addr, uint32_t value)
+{
+    size_t idx = (size_t)((uint32_t *)addr - registers);
+
+    assert(idx < REG_COUNT);
+
+    simulated_registers[idx] = value;
+}
+
+static void report_access(
+    uint32_t module_idx,
+    volatile const void *addr,
+    uint32_t value,
+    bool write)
+{
+    report_count++;
+    last_module_idx = module_idx;
+    last_addr = addr;
+    last_value = value;
+    last_write = write;
+}
+
+static const struct fwk_mmio_driver default_driver = {
+    .read32 = simulated_read32,
+    .write32 = simulated_write32,
+    .report_access = report_access,
+};
+
+static struct fwk_mmio_driver driver;
+
+struct fwk_mmio_driver fmw_mmio_driver(void)
+{
+    return driver;
+}
+
+static int test_suite_setup(void)
+{
+    return FWK_SUCCESS;
+}
+
+static void test_case_setup(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < REG_COUNT; i++) {
+        registers[i] = 0;
+        simulated_registers[i] = 0;
+    }
+
+    report_count = 0;
+
+    driver = default_driver;
+    fwk_mmio_init();
+    fwk_mmio_reset_count();
+}
+
+static void test_fwk_mmio_simulated_memory(void)
+{
+    uint32_t value;
+
+    FWK_MMIO_WRITE32(&registers[1], 0xA5A5A5A5);
+    assert(registers[1] == 0);
+    assert(simulated_registers[1] == 0xA5A5A5A5);
+
+    simulated_registers[2] = 0x12345678;
+    value = FWK_MMIO_READ32(&registers[2]);
+    assert(value == 0x12345678);
+}
+
+static void test_fwk_mmio_no_driver(void)
+{
+    uint32_t value;
+
+    driver.read32 = NULL;
+    driver.write32 = NULL;
+    driver.report_access = NULL;
+    fwk_mmio_init();
+
+    FWK_MMIO_WRITE32(&registers[0], 0xCAFE);
+    assert(registers[0] == 0xCAFE);
+    assert(simulated_registers[0] == 0);
+
+    value = FWK_MMIO_READ32(&registers[0]);
+    assert(value == 0xCAFE);
+    assert(report_count == 0);
+}
+
+static void test_fwk_mmio_report_access(void)
+{
+    FWK_MMIO_WRITE32(&registers[3], 42);
+    assert(report_count == 1);
+    assert(last_module_idx == FWK_MODULE_IDX_TEST1);
+    assert(last_addr == &registers[3]);
+    assert(last_value == 42);
+    assert(last_write);
+
+    (void)FWK_MMIO_READ32(&registers[3]);
+    assert(report_count == 2);
+    assert(last_value == 42);
+    assert(!last_write);
+}
+
+static void test_fwk_mmio_count(void)
+{
+    int status;
+    struct fwk_mmio_count count;
+
+    FWK_MMIO_WRITE32(&registers[0], 1);
+    (void)FWK_MMIO_READ32(&registers[0]);
+    (void)FWK_MMIO_READ32(&registers[0]);
+    (void)fwk_mmio_read32(FWK_MODULE_IDX_TEST0, &registers[0]);
+    fwk_mmio_write32(FWK_MMIO_MODULE_IDX_NONE, &registers[0], 2);
+
+    status = fwk_mmio_get_count(fwk_module_id_test1, &count);
+    assert(status == FWK_SUCCESS);
+    assert(count.read_count == 2);
+    assert(count.write_count == 1);
+
+    status = fwk_mmio_get_count(fwk_module_id_test0, &count);
+    assert(status == FWK_SUCCESS);
+    assert(count.read_count == 1);
+    assert(count.write_count == 0);
+
+    status = fwk_mmio_get_count(fwk_module_id_test2, &count);
+    assert(status == FWK_SUCCESS);
+    assert(count.read_count == 0);
+    assert(count.write_count == 0);
+
+    status = fwk_mmio_get_count(FWK_ID_NONE, &count);
+    assert(status == FWK_SUCCESS);
+    assert(count.read_count == 0);
+    assert(count.write_count == 1);
+
+    fwk_mmio_reset_count();
+
+    status = fwk_mmio_get_count(fwk_module_id_test1, &count);
+    assert(status == FWK_SUCCESS);
+    assert(count.read_count == 0);
+    assert(count.write_count == 0);
+}
+
+static void test_fwk_mmio_get_count_invalid_param(void)
+{
+    int status;
+    struct fwk_mmio_count count;
+
+    status = fwk_mmio_get_count(fwk_module_id_test0, NULL);
+    assert(status == FWK_E_PARAM);
+
+    status =
+        fwk_mmio_get_count(FWK_ID_ELEMENT(FWK_MODULE_IDX_TEST0, 0), &count);
+    assert(status == FWK_E_PARAM);
+
+    status = fwk_mmio_get_count(FWK_ID_MODULE(FWK_MODULE_IDX_COUNT), &count);
+    assert(status == FWK_E_PARAM);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_mmio_simulated_memory),
+    FWK_TEST_CASE(test_fwk_mmio_no_driver),
+    FWK_TEST_CASE(test_fwk_mmio_report_access),
+    FWK_TEST_CASE(test_fwk_mmio_count),
+    FWK_TEST_CASE(test_fwk_mmio_get_count_invalid_param),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_mmio",
+
+    .test_suite_setup = test_suite_setup,
+    .test_case_setup = test_case_setup,
+
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
@@ -71,6 +71,23 @@ struct interface_power_management_api {
     int (*set_limit)(fwk_id_t id, uint32_t power_limit);
 };
 
+/*!
+ * \brief Power Management control loop phase interface
+ *
+ * \details Implemented by the Power Management modules taking part in the
+ *          control loop run by the power coordinator.
+ */
+struct interface_power_management_phase_api {
+    /*!
+     * \brief Run the phase of the control loop
+     * \param id Identifier of the entity running the phase.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval One of the standard framework status codes.
+     */
+    int (*run)(fwk_id_t id);
+};
+
 /*!
  * @}
  */
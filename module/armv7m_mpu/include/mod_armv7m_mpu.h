@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,7 @@
 #include <fmw_cmsis.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 /*!
  * \ingroup GroupModules
@@ -38,6 +39,101 @@ struct mod_armv7m_mpu_config {
     const ARM_MPU_Region_t *regions;
 };
 
+/*!
+ * \brief Size of the data cache maintenance granule, in bytes.
+ */
+#define MOD_ARMV7M_MPU_CACHE_LINE_SIZE 32U
+
+/*!
+ * \brief Module API indices.
+ */
+enum mod_armv7m_mpu_api_idx {
+    /*! Region API, see ::mod_armv7m_mpu_region_api */
+    MOD_ARMV7M_MPU_API_IDX_REGION,
+
+    /*! Number of APIs */
+    MOD_ARMV7M_MPU_API_IDX_COUNT,
+};
+
+/*!
+ * \brief Region API.
+ *
+ * \details Changes the attributes of memory regions at runtime, e.g. to keep
+ *      a structure cacheable while it is private to the processor and make it
+ *      non-cacheable while it is shared, and maintains the data cache for the
+ *      mapped regions around such changes.
+ *
+ *      The cache maintenance functions do nothing when the processor has no
+ *      data cache.
+ */
+struct mod_armv7m_mpu_region_api {
+    /*!
+     * \brief Reprogram a set of MPU regions.
+     *
+     * \details The regions are reprogrammed with the interrupts disabled and
+     *      a single set of barriers, so that no access sees a partially
+     *      updated set of regions. The MPU stays enabled: the regions covering
+     *      the code and the stack running the update must not be changed.
+     *
+     *      The region number is taken from each \c RBAR value, which must have
+     *      its \c VALID bit set, e.g. built with \c ARM_MPU_RBAR().
+     *
+     * \param regions Pointer to the array of MPU regions.
+     * \param region_count Number of MPU regions.
+     *
+     * \retval ::FWK_SUCCESS The regions were reprogrammed.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_RANGE A region number is not implemented by the MPU.
+     */
+    int (*update_regions)(const ARM_MPU_Region_t *regions,
+                          size_t region_count);
+
+    /*!
+     * \brief Clean the data cache for a range of addresses.
+     *
+     * \details Writes the dirty cache lines back to memory, e.g. before
+     *      another agent reads from a cacheable region.
+     *
+     * \param base Base address of the range.
+     * \param size Size of the range, in bytes.
+     *
+     * \retval ::FWK_SUCCESS The range was cleaned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*clean_dcache)(uintptr_t base, size_t size);
+
+    /*!
+     * \brief Invalidate the data cache for a range of addresses.
+     *
+     * \details Discards the cache lines, e.g. before reading data another
+     *      agent wrote to a cacheable region. The range must be aligned to
+     *      ::MOD_ARMV7M_MPU_CACHE_LINE_SIZE so that no unrelated data is
+     *      discarded.
+     *
+     * \param base Base address of the range.
+     * \param size Size of the range, in bytes.
+     *
+     * \retval ::FWK_SUCCESS The range was invalidated.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_ALIGN The range is not aligned to a cache line.
+     */
+    int (*invalidate_dcache)(uintptr_t base, size_t size);
+
+    /*!
+     * \brief Clean and invalidate the data cache for a range of addresses.
+     *
+     * \details To be used when a cacheable region is made non-cacheable, so
+     *      that neither dirty nor stale lines are left behind.
+     *
+     * \param base Base address of the range.
+     * \param size Size of the range, in bytes.
+     *
+     * \retval ::FWK_SUCCESS The range was cleaned and invalidated.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*clean_invalidate_dcache)(uintptr_t base, size_t size);
+};
+
 /*!
  * \}
  */
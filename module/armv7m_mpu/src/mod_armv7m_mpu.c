@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,11 +9,120 @@
 
 #include <fwk_assert.h>
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
 #include <fwk_module.h>
 #include <fwk_status.h>
 
 #include <fmw_cmsis.h>
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of regions implemented by the MPU */
+static uint32_t mpu_implemented_region_count(void)
+{
+    return (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+}
+
+static bool dcache_range_is_valid(uintptr_t base, size_t size)
+{
+    return (size != 0) && (size <= (size_t)INT32_MAX) &&
+        (base <= (UINTPTR_MAX - size));
+}
+
+/*
+ * Region API
+ */
+
+static int armv7m_mpu_update_regions(const ARM_MPU_Region_t *regions,
+                                     size_t region_count)
+{
+    size_t i;
+    unsigned int flags;
+    uint32_t implemented_count;
+
+    if (regions == NULL)
+        return FWK_E_PARAM;
+
+    implemented_count = mpu_implemented_region_count();
+
+    for (i = 0; i < region_count; i++) {
+        if ((regions[i].RBAR & MPU_RBAR_VALID_Msk) == 0)
+            return FWK_E_PARAM;
+
+        if ((regions[i].RBAR & MPU_RBAR_REGION_Msk) >= implemented_count)
+            return FWK_E_RANGE;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    /* Complete the outstanding accesses with the current attributes */
+    __DMB();
+
+    for (i = 0; i < region_count; i++)
+        ARM_MPU_SetRegion(regions[i].RBAR, regions[i].RASR);
+
+    /* Apply the new attributes from the next access and instruction */
+    __DSB();
+    __ISB();
+
+    fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
+static int armv7m_mpu_clean_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int armv7m_mpu_invalidate_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+    /* Invalidating a partial line would discard unrelated data */
+    if (((base | size) % MOD_ARMV7M_MPU_CACHE_LINE_SIZE) != 0)
+        return FWK_E_ALIGN;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int armv7m_mpu_clean_invalidate_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_armv7m_mpu_region_api region_api = {
+    .update_regions = armv7m_mpu_update_regions,
+    .clean_dcache = armv7m_mpu_clean_dcache,
+    .invalidate_dcache = armv7m_mpu_invalidate_dcache,
+    .clean_invalidate_dcache = armv7m_mpu_clean_invalidate_dcache,
+};
+
+/*
+ * Framework handlers
+ */
+
 static int armv7m_mpu_init(
     fwk_id_t module_id,
     unsigned int element_count,
@@ -33,8 +142,24 @@ static int armv7m_mpu_init(
     return FWK_SUCCESS;
 }
 
+static int armv7m_mpu_process_bind_request(
+    fwk_id_t requester_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    if (fwk_id_get_api_idx(api_id) != MOD_ARMV7M_MPU_API_IDX_REGION)
+        return FWK_E_PARAM;
+
+    *api = &region_api;
+
+    return FWK_SUCCESS;
+}
+
 /* Module description */
 const struct fwk_module module_armv7m_mpu = {
     .type = FWK_MODULE_TYPE_DRIVER,
+    .api_count = MOD_ARMV7M_MPU_API_IDX_COUNT,
     .init = armv7m_mpu_init,
+    .process_bind_request = armv7m_mpu_process_bind_request,
 };
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,11 +9,119 @@
 
 #include <fwk_assert.h>
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
 #include <fwk_module.h>
 #include <fwk_status.h>
 
 #include <fmw_cmsis.h>
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of regions implemented by the MPU */
+static uint32_t mpu_implemented_region_count(void)
+{
+    return (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+}
+
+static bool dcache_range_is_valid(uintptr_t base, size_t size)
+{
+    return (size != 0) && (size <= (size_t)INT32_MAX) &&
+        (base <= (UINTPTR_MAX - size));
+}
+
+/*
+ * Region API
+ */
+
+static int armv8m_mpu_update_regions(uint32_t first_region_number,
+                                     const ARM_MPU_Region_t *regions,
+                                     uint32_t region_count)
+{
+    uint32_t i;
+    unsigned int flags;
+    uint32_t implemented_count;
+
+    if (regions == NULL)
+        return FWK_E_PARAM;
+
+    implemented_count = mpu_implemented_region_count();
+
+    if ((region_count > implemented_count) ||
+        (first_region_number > (implemented_count - region_count)))
+        return FWK_E_RANGE;
+
+    flags = fwk_interrupt_global_disable();
+
+    /* Complete the outstanding accesses with the current attributes */
+    __DMB();
+
+    for (i = 0; i < region_count; i++) {
+        ARM_MPU_SetRegion(
+            first_region_number + i, regions[i].RBAR, regions[i].RLAR);
+    }
+
+    /* Apply the new attributes from the next access and instruction */
+    __DSB();
+    __ISB();
+
+    fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
+static int armv8m_mpu_clean_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int armv8m_mpu_invalidate_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+    /* Invalidating a partial line would discard unrelated data */
+    if (((base | size) % MOD_ARMV8M_MPU_CACHE_LINE_SIZE) != 0)
+        return FWK_E_ALIGN;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int armv8m_mpu_clean_invalidate_dcache(uintptr_t base, size_t size)
+{
+    if (!dcache_range_is_valid(base, size))
+        return FWK_E_PARAM;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)base, (int32_t)size);
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_armv8m_mpu_region_api region_api = {
+    .update_regions = armv8m_mpu_update_regions,
+    .clean_dcache = armv8m_mpu_clean_dcache,
+    .invalidate_dcache = armv8m_mpu_invalidate_dcache,
+    .clean_invalidate_dcache = armv8m_mpu_clean_invalidate_dcache,
+};
+
+/*
+ * Framework handlers
+ */
+
 static int armv8m_mpu_init(
     fwk_id_t module_id,
     unsigned int element_count,
@@ -47,8 +155,24 @@ static int armv8m_mpu_init(
     return status;
 }
 
+static int armv8m_mpu_process_bind_request(
+    fwk_id_t requester_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    if (fwk_id_get_api_idx(api_id) != MOD_ARMV8M_MPU_API_IDX_REGION)
+        return FWK_E_PARAM;
+
+    *api = &region_api;
+
+    return FWK_SUCCESS;
+}
+
 /* Module description */
 const struct fwk_module module_armv8m_mpu = {
     .type = FWK_MODULE_TYPE_DRIVER,
+    .api_count = MOD_ARMV8M_MPU_API_IDX_COUNT,
     .init = armv8m_mpu_init,
+    .process_bind_request = armv8m_mpu_process_bind_request,
 };
@@ -156,6 +156,24 @@ struct mod_dvfs_domain_api {
      */
     int (*get_latency)(fwk_id_t domain_id, uint16_t *latency);
 
+    /*!
+     * \brief Get the table of operating points of a domain.
+     *
+     * \details The table is returned in place rather than copied, so that a
+     *      caller can walk any range of it without one call per operating
+     *      point. It remains valid for the lifetime of the firmware.
+     *
+     * \param domain_id Element identifier of the domain.
+     * \param [out] opps Operating points of the domain.
+     * \param [out] opp_count Number of operating points.
+     * \param [out] latency Worst-case transition latency.
+     */
+    int (*get_opp_table)(
+        fwk_id_t domain_id,
+        const struct mod_dvfs_opp **opps,
+        size_t *opp_count,
+        uint16_t *latency);
+
     /*!
      * \brief Set the level of a domain.
      *
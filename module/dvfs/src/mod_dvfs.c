@@ -492,6 +492,30 @@ static int dvfs_get_latency(fwk_id_t domain_id, uint16_t *latency)
     return FWK_SUCCESS;
 }
 
+static int dvfs_get_opp_table(
+    fwk_id_t domain_id,
+    const struct mod_dvfs_opp **opps,
+    size_t *opp_count,
+    uint16_t *latency)
+{
+    const struct mod_dvfs_domain_ctx *ctx;
+
+    if ((opps == NULL) || (opp_count == NULL) || (latency == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = get_domain_ctx(domain_id);
+    if (ctx == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    *opps = ctx->config->opps;
+    *opp_count = ctx->opp_count;
+    *latency = ctx->config->latency;
+
+    return FWK_SUCCESS;
+}
+
 /*
  * dvfs_get_current_opp() may be either synchronous or asynchronous
  */
@@ -579,6 +603,7 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_level_id = dvfs_get_level_id,
     .get_opp_count = dvfs_get_opp_count,
     .get_latency = dvfs_get_latency,
+    .get_opp_table = dvfs_get_opp_table,
     .set_level = dvfs_set_level,
 };
 
@@ -578,6 +578,72 @@ void utest_dvfs_get_latency(void)
     TEST_ASSERT_EQUAL(3, latency);
 }
 
+void utest_dvfs_get_opp_table_null_opps(void)
+{
+    fwk_id_t dvfs_id;
+    size_t opp_count;
+    uint16_t latency;
+    int return_opp_table;
+
+    return_opp_table = dvfs_get_opp_table(dvfs_id, NULL, &opp_count, &latency);
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, return_opp_table);
+}
+
+void utest_dvfs_get_opp_table_invalid_dvfs_id(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1];
+    const struct mod_dvfs_opp *opps;
+    size_t opp_count;
+    uint16_t latency;
+    int return_opp_table;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 2);
+
+    return_opp_table = dvfs_get_opp_table(dvfs_id, &opps, &opp_count, &latency);
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, return_opp_table);
+}
+
+void utest_dvfs_get_opp_table(void)
+{
+    fwk_id_t dvfs_id;
+    struct mod_dvfs_domain_ctx dvfs_domain_ctx[1];
+    struct mod_dvfs_domain_config config;
+    struct mod_dvfs_opp config_opps[3] = {
+        { .level = 1 },
+        { .level = 2 },
+        { 0 },
+    };
+    const struct mod_dvfs_opp *opps = NULL;
+    size_t opp_count = 0;
+    uint16_t latency = 0;
+    int return_opp_table;
+
+    dvfs_ctx.dvfs_domain_element_count = 1;
+
+    dvfs_ctx.domain_ctx = &dvfs_domain_ctx;
+
+    config.opps = config_opps;
+    config.latency = 3;
+    dvfs_domain_ctx[0].config = &config;
+    dvfs_domain_ctx[0].opp_count = 2;
+
+    fwk_id_get_element_idx_ExpectAndReturn(dvfs_id, 0);
+
+    return_opp_table = dvfs_get_opp_table(dvfs_id, &opps, &opp_count, &latency);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, return_opp_table);
+    TEST_ASSERT_EQUAL_PTR(config_opps, opps);
+    TEST_ASSERT_EQUAL(2, opp_count);
+    TEST_ASSERT_EQUAL(3, latency);
+}
+
 int dvfs_test_main(void)
 {
     UNITY_BEGIN();
@@ -616,6 +682,10 @@ int dvfs_test_main(void)
     RUN_TEST(utest_dvfs_get_latency_invalid_dvfs_id);
     RUN_TEST(utest_dvfs_get_latency);
 
+    RUN_TEST(utest_dvfs_get_opp_table_null_opps);
+    RUN_TEST(utest_dvfs_get_opp_table_invalid_dvfs_id);
+    RUN_TEST(utest_dvfs_get_opp_table);
+
     return UNITY_END();
 }
 
@@ -12,6 +12,7 @@
 #include <mod_timer.h>
 #include <mod_transport.h>
 
+#include <fwk_attributes.h>
 #include <fwk_id.h>
 #include <fwk_log.h>
 #include <fwk_mm.h>
@@ -46,7 +47,7 @@ struct mod_fch_polled_ctx {
 
 static struct mod_fch_polled_ctx fch_polled_ctx;
 
-static void fast_channel_alarm_callback(uintptr_t ch_ctx)
+static FWK_HOT void fast_channel_alarm_callback(uintptr_t ch_ctx)
 {
     struct mod_fch_polled_channel_ctx *channel_ctx;
 
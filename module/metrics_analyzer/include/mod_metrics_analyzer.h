@@ -29,6 +29,8 @@
 enum mod_metrics_analyzer_api_idx {
     /*! Metrics_Analyzer API analyze idx */
     MOD_METRICS_ANALYZER_API_IDX_ANALYZE,
+    /*! Metrics_Analyzer power management phase API idx */
+    MOD_METRICS_ANALYZER_API_IDX_PHASE,
     /*! Metrics_Analyzer API count */
     MOD_METRICS_ANALYZER_API_IDX_COUNT,
 };
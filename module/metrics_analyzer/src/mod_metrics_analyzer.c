@@ -132,6 +132,15 @@ static struct mod_metrics_analyzer_analyze_api analyze_api = {
     .analyze = analyze,
 };
 
+static int run_phase(fwk_id_t id)
+{
+    return analyze();
+}
+
+static struct interface_power_management_phase_api phase_api = {
+    .run = run_phase,
+};
+
 /*
  * Framework handlers
  */
@@ -230,16 +239,25 @@ static int metrics_analyzer_process_bind_request(
         return FWK_E_PARAM;
     }
 
-    if (!fwk_id_is_equal(
+    if (fwk_id_is_equal(
             api_id,
             FWK_ID_API(
                 FWK_MODULE_IDX_METRICS_ANALYZER,
                 MOD_METRICS_ANALYZER_API_IDX_ANALYZE))) {
-        return FWK_E_PARAM;
+        *api = &analyze_api;
+        return FWK_SUCCESS;
     }
 
-    *api = &analyze_api;
-    return FWK_SUCCESS;
+    if (fwk_id_is_equal(
+            api_id,
+            FWK_ID_API(
+                FWK_MODULE_IDX_METRICS_ANALYZER,
+                MOD_METRICS_ANALYZER_API_IDX_PHASE))) {
+        *api = &phase_api;
+        return FWK_SUCCESS;
+    }
+
+    return FWK_E_PARAM;
 }
 
 static int metrics_analyzer_start(fwk_id_t id)
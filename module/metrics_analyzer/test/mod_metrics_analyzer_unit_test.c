@@ -258,6 +258,22 @@ void test_process_bind_request_correct_api(void)
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
 }
 
+void test_process_bind_request_phase_api(void)
+{
+    int status = FWK_E_INIT;
+    const struct interface_power_management_phase_api *api = NULL;
+    status = metrics_analyzer_process_bind_request(
+        FWK_ID_NONE,
+        MOD_METRICS_ANALYZER_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_METRICS_ANALYZER,
+            MOD_METRICS_ANALYZER_API_IDX_PHASE),
+        (const void **)&api);
+
+    TEST_ASSERT_EQUAL(&phase_api, api);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
 void test_process_start_success(void)
 {
     TEST_ASSERT_EQUAL(
@@ -574,6 +590,7 @@ int metrics_analyzer_test_main(void)
     RUN_TEST(test_bind_element_providers_and_consumer);
     RUN_TEST(test_process_bind_request_invalid_params);
     RUN_TEST(test_process_bind_request_correct_api);
+    RUN_TEST(test_process_bind_request_phase_api);
     RUN_TEST(test_process_start_success);
     RUN_TEST(test_collect_domain_limits_invalid_params);
     RUN_TEST(test_collect_domain_limits_first_time);
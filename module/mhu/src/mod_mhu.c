@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,6 +13,7 @@
 #include <mod_mhu.h>
 #include <mod_transport.h>
 
+#include <fwk_attributes.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_log.h>
@@ -63,7 +64,7 @@ struct mod_mhu_ctx {
 
 static struct mod_mhu_ctx mhu_ctx;
 
-static void mhu_isr(void)
+static FWK_HOT void mhu_isr(void)
 {
     int status;
     unsigned int interrupt;
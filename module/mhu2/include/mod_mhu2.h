@@ -46,6 +46,13 @@ struct mod_mhu2_channel_config {
     /*! IRQ number of the receive interrupt line */
     unsigned int irq;
 
+    /*!
+     * \brief Priority of the receive interrupt line.
+     *
+     * \details Zero leaves the interrupt at its reset priority.
+     */
+    unsigned int irq_priority;
+
     /*! Base address of the registers of the incoming MHU */
     uintptr_t recv;
 
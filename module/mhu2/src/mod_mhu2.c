@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -14,10 +14,12 @@
 #include <mod_transport.h>
 
 #include <fwk_assert.h>
+#include <fwk_attributes.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_log.h>
 #include <fwk_mm.h>
+#include <fwk_mmio.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
@@ -79,7 +81,7 @@ static struct mhu2_ctx {
     unsigned int channel_count;
 } ctx;
 
-static void mhu2_isr(uintptr_t ctx_param)
+static FWK_HOT void mhu2_isr(uintptr_t ctx_param)
 {
     struct mhu2_channel_ctx *channel_ctx = (struct mhu2_channel_ctx *)ctx_param;
     struct mhu2_bound_channel *bound_channel;
@@ -87,8 +89,8 @@ static void mhu2_isr(uintptr_t ctx_param)
 
     fwk_assert(channel_ctx != NULL);
 
-    while (channel_ctx->recv_channel->STAT != 0) {
-        slot = __builtin_ctz(channel_ctx->recv_channel->STAT);
+    while (FWK_MMIO_READ32(&channel_ctx->recv_channel->STAT) != 0) {
+        slot = __builtin_ctz(FWK_MMIO_READ32(&channel_ctx->recv_channel->STAT));
         /*
          * If the slot is bound to a transport channel,
          * signal the message to the corresponding module
@@ -99,7 +101,7 @@ static void mhu2_isr(uintptr_t ctx_param)
             bound_channel->driver_input_api->signal_message(bound_channel->id);
         }
         /* Acknowledge the interrupt */
-        channel_ctx->recv_channel->STAT_CLEAR = 1 << slot;
+        FWK_MMIO_WRITE32(&channel_ctx->recv_channel->STAT_CLEAR, 1 << slot);
     }
 }
 
@@ -118,14 +120,34 @@ static int raise_interrupt(fwk_id_t slot_id)
     send = channel_ctx->send;
 
     /* Turn on receiver */
-    send->ACCESS_REQUEST = 1;
-    while (send->ACCESS_READY != 1)
+    FWK_MMIO_WRITE32(&send->ACCESS_REQUEST, 1);
+    while (FWK_MMIO_READ32(&send->ACCESS_READY) != 1)
         continue;
 
-    channel_ctx->send_channel->STAT_SET |= (1 << slot);
+    FWK_MMIO_WRITE32(
+        &channel_ctx->send_channel->STAT_SET,
+        FWK_MMIO_READ32(&channel_ctx->send_channel->STAT_SET) | (1 << slot));
 
     /* Signal that the receiver is no longer needed */
-    send->ACCESS_REQUEST = 0;
+    FWK_MMIO_WRITE32(&send->ACCESS_REQUEST, 0);
+
+    return FWK_SUCCESS;
+}
+
+static int poll_interrupt(fwk_id_t slot_id, bool *pending)
+{
+    uint32_t slot_mask;
+    struct mhu2_channel_ctx *channel_ctx;
+
+    channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(slot_id)];
+    slot_mask = UINT32_C(1) << fwk_id_get_sub_element_idx(slot_id);
+
+    *pending =
+        ((FWK_MMIO_READ32(&channel_ctx->recv_channel->STAT) & slot_mask) != 0);
+
+    /* Acknowledge the doorbell so that the interrupt is not taken */
+    if (*pending)
+        FWK_MMIO_WRITE32(&channel_ctx->recv_channel->STAT_CLEAR, slot_mask);
 
     return FWK_SUCCESS;
 }
@@ -164,7 +186,7 @@ static int mhu2_send_message(
     }
 
     /* Read the number of channels implemented */
-    channel_count = send->MSG_NO_CAP;
+    channel_count = FWK_MMIO_READ32(&send->MSG_NO_CAP);
 
     /* Check if minimum number of MHUv2 channels are available */
     if (channel_count < (min_channels_required + channels_used_for_payload)) {
@@ -175,8 +197,8 @@ static int mhu2_send_message(
     }
 
     /* Turn on receiver */
-    send->ACCESS_REQUEST = 1;
-    while (send->ACCESS_READY != 1)
+    FWK_MMIO_WRITE32(&send->ACCESS_REQUEST, 1);
+    while (FWK_MMIO_READ32(&send->ACCESS_READY) != 1)
         continue;
 
     /* Get the channel used for doorbell */
@@ -188,7 +210,7 @@ static int mhu2_send_message(
         if (ch == db_ch)
             continue;
 
-        send->channel[ch].STAT_SET = msg_ptr[idx];
+        FWK_MMIO_WRITE32(&send->channel[ch].STAT_SET, msg_ptr[idx]);
         idx++;
     }
 
@@ -204,13 +226,14 @@ static int mhu2_send_message(
             if ((ch + payload_idx) == db_ch)
                 continue;
 
-            send->channel[payload_idx + ch].STAT_SET =
-                message->payload[payload_idx];
+            FWK_MMIO_WRITE32(
+                &send->channel[payload_idx + ch].STAT_SET,
+                message->payload[payload_idx]);
         }
     }
 
     /* Receiver no longer required */
-    send->ACCESS_REQUEST = 0;
+    FWK_MMIO_WRITE32(&send->ACCESS_REQUEST, 0);
 
     return FWK_SUCCESS;
 }
@@ -242,10 +265,10 @@ static int mhu2_get_message(
         if (ch == db_ch)
             continue;
 
-        msg_ptr[idx++] = recv->channel[ch].STAT;
+        msg_ptr[idx++] = FWK_MMIO_READ32(&recv->channel[ch].STAT);
 
         /* Clear the message status register */
-        recv->channel[ch].STAT_CLEAR = 0xffffffff;
+        FWK_MMIO_WRITE32(&recv->channel[ch].STAT_CLEAR, 0xffffffff);
     }
 
     /* Calculate size of the received payload */
@@ -261,10 +284,11 @@ static int mhu2_get_message(
                 continue;
 
             message->payload[payload_idx] =
-                recv->channel[payload_idx + ch].STAT;
+                FWK_MMIO_READ32(&recv->channel[payload_idx + ch].STAT);
 
             /* Clear the message status register */
-            recv->channel[payload_idx + ch].STAT_CLEAR = 0xffffffff;
+            FWK_MMIO_WRITE32(
+                &recv->channel[payload_idx + ch].STAT_CLEAR, 0xffffffff);
         }
     }
 
@@ -278,6 +302,7 @@ struct mod_transport_driver_api mhu2_mod_transport_driver_api = {
     .get_message = mhu2_get_message,
 #    endif
     .trigger_event = raise_interrupt,
+    .poll_event = poll_interrupt,
 };
 
 /*
@@ -318,7 +343,7 @@ static int mhu2_channel_init(fwk_id_t channel_id,
     channel_ctx = &ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
     channel_ctx->send = (struct mhu2_send_reg *)config->send;
 
-    if (config->channel >= channel_ctx->send->MSG_NO_CAP) {
+    if (config->channel >= FWK_MMIO_READ32(&channel_ctx->send->MSG_NO_CAP)) {
         fwk_unexpected();
         return FWK_E_DATA;
     }
@@ -333,7 +358,7 @@ static int mhu2_channel_init(fwk_id_t channel_id,
      * Mask the channels used for transferring in-band messages.
      * Only the doorbell channel should be used to raise interrupt.
      */
-    for (uint8_t ch = 0; ch < recv_reg->MSG_NO_CAP; ch++) {
+    for (uint8_t ch = 0; ch < FWK_MMIO_READ32(&recv_reg->MSG_NO_CAP); ch++) {
         /* Skip the channel used for doorbell */
         if (ch == config->channel)
             continue;
@@ -344,7 +369,7 @@ static int mhu2_channel_init(fwk_id_t channel_id,
          * Masked channels don't generate interrupt when data is written
          * to them.
          */
-        recv_reg->channel[ch].MASK_SET = 0xffffffff;
+        FWK_MMIO_WRITE32(&recv_reg->channel[ch].MASK_SET, 0xffffffff);
     }
 #endif
     channel_ctx->recv_channel = &recv_reg->channel[config->channel];
@@ -449,6 +474,15 @@ static int mhu2_start(fwk_id_t id)
             fwk_unexpected();
             return status;
         }
+        if (channel_ctx->config->irq_priority != 0) {
+            status = fwk_interrupt_set_priority(
+                channel_ctx->config->irq, channel_ctx->config->irq_priority);
+            if (status != FWK_SUCCESS) {
+                /* Failed to set the interrupt priority */
+                fwk_unexpected();
+                return status;
+            }
+        }
         status = fwk_interrupt_enable(channel_ctx->config->irq);
         if (status != FWK_SUCCESS) {
             /* Failed to enable isr */
@@ -18,6 +18,7 @@
 
 #include <mod_transport.h>
 
+#include <fwk_attributes.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_log.h>
@@ -87,7 +88,7 @@ struct channel_status_data {
 
 static struct mod_mhu3_ctx mhu3_ctx;
 
-static void mhu3_isr(void)
+static FWK_HOT void mhu3_isr(void)
 {
     int status;
     unsigned int interrupt;
@@ -180,6 +180,29 @@ static int smt_write_payload(fwk_id_t channel_id,
     return FWK_SUCCESS;
 }
 
+static int smt_get_response_buffer(fwk_id_t channel_id,
+                                   void **payload,
+                                   size_t *size)
+{
+    struct smt_channel_ctx *channel_ctx;
+
+    if ((payload == NULL) || (size == NULL)) {
+        fwk_assert(false);
+        return FWK_E_PARAM;
+    }
+
+    channel_ctx =
+        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    if (!channel_ctx->locked)
+        return FWK_E_ACCESS;
+
+    *payload = channel_ctx->out->payload;
+    *size = channel_ctx->max_payload_size;
+
+    return FWK_SUCCESS;
+}
+
 static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
 {
     struct smt_channel_ctx *channel_ctx;
@@ -188,8 +211,11 @@ static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
     channel_ctx = &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
     memory = ((struct mod_msg_smt_memory *) channel_ctx->out);
 
-    /* Copy the payload from either the write buffer or the payload parameter */
-    if (payload) {
+    /*
+     * Copy the payload from the payload parameter, unless it has been built in
+     * the write buffer already
+     */
+    if (payload && (payload != memory->payload)) {
         memcpy(memory->payload, payload, size);
     }
 
@@ -241,6 +267,7 @@ static const struct mod_scmi_to_transport_api smt_mod_scmi_to_transport_api = {
     .get_message_header = smt_get_message_header,
     .get_payload = smt_get_payload,
     .write_payload = smt_write_payload,
+    .get_response_buffer = smt_get_response_buffer,
     .respond = smt_respond,
     .transmit = smt_transmit,
 };
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -26,6 +26,12 @@
  * \{
  */
 
+/*!
+ * \brief The maximum number of register reads when waiting for a divider,
+ *      source or modulator change to take effect.
+ */
+#define MOD_PIK_CLOCK_WAIT_TIMEOUT UINT32_C(0x10000)
+
 /*!
  * \brief APIs provided by the driver.
  */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -118,6 +118,23 @@ static struct pik_clock_ctx module_ctx;
  * Static helper functions
  */
 
+/*
+ * Wait until a register field reads the given value, the wait being bounded by
+ * MOD_PIK_CLOCK_WAIT_TIMEOUT reads.
+ */
+static int pik_clock_wait(volatile uint32_t *reg, uint32_t mask,
+                          uint32_t value)
+{
+    unsigned int wait_cycles = MOD_PIK_CLOCK_WAIT_TIMEOUT;
+
+    while ((*reg & mask) != value) {
+        if (wait_cycles-- == 0)
+            return FWK_E_TIMEOUT;
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int compare_rate_entry(const void *a, const void *b)
 {
     struct mod_pik_clock_rate *key = (struct mod_pik_clock_rate *)a;
@@ -171,9 +188,9 @@ static int ssclock_set_div(struct pik_clock_dev_ctx *ctx, uint32_t divider,
                    (clkdiv << SSCLK_CONTROL_CLKDIV_POS);
 
     if (wait_after_set) {
-        while ((*ctx->config->control_reg & SSCLK_CONTROL_CRNTCLKDIV) !=
-               (clkdiv << SSCLK_CONTROL_CRNTCLKDIV_POS))
-            continue;
+        return pik_clock_wait(ctx->config->control_reg,
+                              SSCLK_CONTROL_CRNTCLKDIV,
+                              clkdiv << SSCLK_CONTROL_CRNTCLKDIV_POS);
     }
 
     return FWK_SUCCESS;
@@ -211,9 +228,8 @@ static int msclock_set_div(struct pik_clock_dev_ctx *ctx,
                    (clkdiv << MSCLK_DIV_CLKDIV_POS);
 
     if (wait_after_set) {
-        while ((*divider_reg & MSCLK_DIV_CRNTCLKDIV) !=
-               (clkdiv << MSCLK_DIV_CRNTCLKDIV_POS))
-            continue;
+        return pik_clock_wait(divider_reg, MSCLK_DIV_CRNTCLKDIV,
+                              clkdiv << MSCLK_DIV_CRNTCLKDIV_POS);
     }
 
     return FWK_SUCCESS;
@@ -234,9 +250,8 @@ static int msclock_set_source(struct pik_clock_dev_ctx *ctx,
                    (source << MSCLK_CONTROL_CLKSEL_POS);
 
     if (wait_after_set) {
-        while ((*ctx->config->control_reg & MSCLK_CONTROL_CRNTCLK) !=
-               ((uint32_t)(source << MSCLK_CONTROL_CRNTCLK_POS)))
-            continue;
+        return pik_clock_wait(ctx->config->control_reg, MSCLK_CONTROL_CRNTCLK,
+                              (uint32_t)(source << MSCLK_CONTROL_CRNTCLK_POS));
     }
 
     return FWK_SUCCESS;
@@ -270,13 +285,10 @@ static int cluster_set_modulator(struct pik_clock_dev_ctx *ctx,
         modulator_setting);
 
     if (wait_after_set) {
-        while ((*ctx->config->modulator_reg & CLUSCLK_MOD_CRNTNUMERATOR) !=
-                (numerator << CLUSCLK_MOD_CRNTNUMERATOR_POS))
-            continue;
-
-        while ((*ctx->config->modulator_reg & CLUSCLK_MOD_CRNTDENOMINATOR) !=
-                (denominator << CLUSCLK_MOD_CRNTDENOMINATOR_POS))
-            continue;
+        return pik_clock_wait(ctx->config->modulator_reg,
+            CLUSCLK_MOD_CRNTNUMERATOR | CLUSCLK_MOD_CRNTDENOMINATOR,
+            (numerator << CLUSCLK_MOD_CRNTNUMERATOR_POS) |
+            (denominator << CLUSCLK_MOD_CRNTDENOMINATOR_POS));
     }
 
     return FWK_SUCCESS;
@@ -13,6 +13,8 @@
 
 #include <fwk_id.h>
 
+#include <stdint.h>
+
 /*!
  * \addtogroup GroupModules Modules
  * \{
@@ -26,6 +28,84 @@
  * \{
  */
 
+/*!
+ * \brief Power allocator module configuration.
+ */
+struct mod_power_allocator_config {
+    /*!
+     * \brief Total power budget shared between the domains.
+     *
+     * \details The budget can be updated at runtime through the limit API
+     *      using the module identifier, for instance by a metrics analyzer
+     *      domain gathering the system wide limits.
+     */
+    uint32_t total_budget;
+};
+
+/*!
+ * \brief Power allocator domain configuration.
+ */
+struct mod_power_allocator_domain_config {
+    /*!
+     * \brief Minimum power allocated to the domain.
+     *
+     * \details The minimum is granted before the rest of the budget is
+     *      shared, unless the budget cannot cover the minimum of all the
+     *      domains in which case it is scaled down.
+     */
+    uint32_t min_power;
+
+    /*!
+     * \brief Maximum power allocated to the domain.
+     */
+    uint32_t max_power;
+
+    /*!
+     * \brief Weight of the domain.
+     *
+     * \details The budget left after granting the minimums is shared in
+     *      proportion of the weights of the domains still needing power.
+     *      A zero weight domain only gets the budget the other domains do not
+     *      need.
+     */
+    uint32_t weight;
+
+    /*!
+     * \brief Identifier of the power demand source of the domain.
+     *
+     * \details Set to ::FWK_ID_NONE when the domain has no demand source, in
+     *      which case its demand is its maximum power.
+     */
+    fwk_id_t demand_source_id;
+
+    /*!
+     * \brief Identifier of the ::mod_power_allocator_demand_api of the demand
+     *      source.
+     */
+    fwk_id_t demand_api_id;
+};
+
+/*!
+ * \brief Power demand interface.
+ *
+ * \details Implemented by the modules estimating the power a domain needs,
+ *      for instance from the activity counters or from the performance
+ *      requests of the domain.
+ */
+struct mod_power_allocator_demand_api {
+    /*!
+     * \brief Get the power demand of a domain.
+     *
+     * \param id Identifier of the demand source.
+     * \param[out] demand Power the domain needs for the next period.
+     *
+     * \retval ::FWK_SUCCESS The demand is returned successfully.
+     * \return One of the standard framework error codes. The domain demand is
+     *      then considered to be its maximum power.
+     */
+    int (*get_demand)(fwk_id_t id, uint32_t *demand);
+};
+
 /*!
  * \brief Power Allocator interface.
  */
@@ -48,6 +128,9 @@ struct mod_power_allocator_api {
      * \param cap The required power cap to be set for a domain specified by the
      *      domain id. Setting this value to zero means disabling power capping.
      *
+     * \details When the allocation phase is bound, the cap is applied with
+     *      the next allocation. Otherwise it is applied straight away.
+     *
      * \retval ::FWK_SUCCESS The cap is set successfully.
      * \retval ::FWK_PENDING The cap hasn't been set yet. The power allocator
      *      is processing the cap set request. Once the power allocator sets a
@@ -63,6 +146,21 @@ enum mod_power_allocator_api_idx {
     /*! Cap set and get API. */
     MOD_POWER_ALLOCATOR_API_IDX_CAP,
 
+    /*!
+     * Budget allocation API, implementing the power management phase
+     * interface. Running the phase collects the demand of the domains,
+     * applies the pending caps and allocates the budget for the next period.
+     * The pending caps complete with the cap changed notification, so binding
+     * to this API requires the notification support.
+     */
+    MOD_POWER_ALLOCATOR_API_IDX_ALLOCATE,
+
+    /*!
+     * Power management limit API. The limit of a domain is the power
+     * allocated to it, the limit of the module is the total budget.
+     */
+    MOD_POWER_ALLOCATOR_API_IDX_LIMIT,
+
     /*! Number of defined APIs. */
     MOD_POWER_ALLOCATOR_API_IDX_COUNT,
 };
@@ -78,6 +176,17 @@ enum mod_power_allocator_notification_idx {
     MOD_POWER_ALLOCATOR_NOTIFICATION_IDX_COUNT,
 };
 
+/*!
+ * \brief Cap changed notification parameters.
+ *
+ * \details The notification is sent from the power allocator module
+ *      identifier.
+ */
+struct mod_power_allocator_notification_params {
+    /*! Identifier of the domain whose cap changed */
+    fwk_id_t domain_id;
+};
+
 /*!
  * \}
  */
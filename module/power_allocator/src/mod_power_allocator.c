@@ -0,0 +1,556 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Power allocator module.
+ */
+
+#include <mod_power_allocator.h>
+
+#include <interface_power_management.h>
+
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_notification.h>
+#include <fwk_status.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Power allocator domain context */
+struct mod_power_allocator_domain_ctx {
+    /* Domain configuration */
+    const struct mod_power_allocator_domain_config *config;
+
+    /* Demand source API, NULL when the domain has no demand source */
+    const struct mod_power_allocator_demand_api *demand_api;
+
+    /* Cap applied to the domain, zero when the domain is not capped */
+    uint32_t cap;
+
+    /* Cap to be applied at the next allocation */
+    uint32_t pending_cap;
+    bool cap_pending;
+
+    /* Allocation bounds and demand for the current period */
+    uint32_t lower;
+    uint32_t upper;
+    uint32_t demand;
+
+    /* Power allocated to the domain */
+    uint32_t allocated;
+};
+
+/* Power allocator module context */
+struct mod_power_allocator_ctx {
+    /* Table of domain contexts */
+    struct mod_power_allocator_domain_ctx *domain_ctx_table;
+
+    /* Number of domains */
+    unsigned int domain_count;
+
+    /* Total budget shared between the domains */
+    uint32_t total_budget;
+
+    /* Whether a power coordinator runs the allocation phase */
+    bool allocate_phase_bound;
+};
+
+static struct mod_power_allocator_ctx power_allocator_ctx;
+
+/*
+ * Helper functions
+ */
+
+static int get_domain_ctx(
+    fwk_id_t domain_id,
+    struct mod_power_allocator_domain_ctx **domain_ctx)
+{
+    unsigned int domain_idx;
+
+    if (!fwk_id_is_type(domain_id, FWK_ID_TYPE_ELEMENT) ||
+        (fwk_id_get_module_idx(domain_id) != FWK_MODULE_IDX_POWER_ALLOCATOR)) {
+        return FWK_E_PARAM;
+    }
+
+    domain_idx = fwk_id_get_element_idx(domain_id);
+    if (domain_idx >= power_allocator_ctx.domain_count) {
+        return FWK_E_PARAM;
+    }
+
+    *domain_ctx = &power_allocator_ctx.domain_ctx_table[domain_idx];
+
+    return FWK_SUCCESS;
+}
+
+static bool is_module_id(fwk_id_t id)
+{
+    return fwk_id_is_equal(id, FWK_ID_MODULE(FWK_MODULE_IDX_POWER_ALLOCATOR));
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+static void notify_cap_changed(unsigned int domain_idx)
+{
+    unsigned int count;
+    int status;
+    struct fwk_event notification = {
+        .id = FWK_ID_NOTIFICATION_INIT(
+            FWK_MODULE_IDX_POWER_ALLOCATOR,
+            MOD_POWER_ALLOCATOR_NOTIFICATION_IDX_CAP_CHANGED),
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_ALLOCATOR),
+    };
+    struct mod_power_allocator_notification_params *params =
+        (struct mod_power_allocator_notification_params *)notification.params;
+
+    params->domain_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_ALLOCATOR, domain_idx);
+
+    status = fwk_notification_notify(&notification, &count);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PWR-ALLOC] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
+static void apply_cap(
+    unsigned int domain_idx,
+    struct mod_power_allocator_domain_ctx *domain_ctx,
+    uint32_t cap)
+{
+    domain_ctx->cap = cap;
+    domain_ctx->cap_pending = false;
+
+#ifdef BUILD_HAS_NOTIFICATION
+    notify_cap_changed(domain_idx);
+#else
+    (void)domain_idx;
+#endif
+}
+
+static void apply_pending_cap(
+    unsigned int domain_idx,
+    struct mod_power_allocator_domain_ctx *domain_ctx)
+{
+    if (domain_ctx->cap_pending) {
+        apply_cap(domain_idx, domain_ctx, domain_ctx->pending_cap);
+    }
+}
+
+/*
+ * Compute the allocation bounds of a domain for the current period. The cap
+ * prevails over the minimum power of the domain.
+ */
+static void update_domain_bounds(
+    struct mod_power_allocator_domain_ctx *domain_ctx)
+{
+    const struct mod_power_allocator_domain_config *config =
+        domain_ctx->config;
+    uint32_t demand;
+    int status;
+
+    domain_ctx->upper = config->max_power;
+    if (domain_ctx->cap != 0) {
+        domain_ctx->upper = FWK_MIN(domain_ctx->upper, domain_ctx->cap);
+    }
+    domain_ctx->lower = FWK_MIN(config->min_power, domain_ctx->upper);
+
+    demand = domain_ctx->upper;
+    if (domain_ctx->demand_api != NULL) {
+        status = domain_ctx->demand_api->get_demand(
+            config->demand_source_id, &demand);
+        if (status != FWK_SUCCESS) {
+            demand = domain_ctx->upper;
+        }
+    }
+
+    domain_ctx->demand =
+        FWK_MAX(domain_ctx->lower, FWK_MIN(demand, domain_ctx->upper));
+}
+
+static uint32_t get_domain_target(
+    const struct mod_power_allocator_domain_ctx *domain_ctx,
+    bool demand_only)
+{
+    return demand_only ? domain_ctx->demand : domain_ctx->upper;
+}
+
+static uint32_t get_domain_share(
+    const struct mod_power_allocator_domain_ctx *domain_ctx,
+    uint32_t budget,
+    uint64_t weight_sum,
+    bool equal_weights)
+{
+    uint64_t weight = equal_weights ? 1 : domain_ctx->config->weight;
+
+    return (uint32_t)((budget * weight) / weight_sum);
+}
+
+/*
+ * Share the budget between the domains in proportion of their weights, up to
+ * their target. The budget a domain does not need is redistributed to the
+ * others within the same call, taking at most one pass per domain. Returns the
+ * budget left.
+ */
+static uint32_t share_budget(uint32_t budget, bool demand_only)
+{
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+    unsigned int idx;
+    unsigned int pending_count;
+    uint64_t weight_sum;
+    uint32_t target;
+    uint32_t share;
+    uint32_t distributed;
+    bool equal_weights;
+    bool saturated;
+
+    while (budget != 0) {
+        pending_count = 0;
+        weight_sum = 0;
+
+        for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+            domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+            if (domain_ctx->allocated <
+                get_domain_target(domain_ctx, demand_only)) {
+                pending_count++;
+                weight_sum += domain_ctx->config->weight;
+            }
+        }
+
+        if (pending_count == 0) {
+            break;
+        }
+
+        /* Only zero weight domains are left, share the budget evenly */
+        equal_weights = (weight_sum == 0);
+        if (equal_weights) {
+            weight_sum = pending_count;
+        }
+
+        /*
+         * The domains whose share covers their need take what they need, the
+         * budget left is then shared again between the other domains.
+         */
+        distributed = 0;
+        saturated = false;
+        for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+            domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+            target = get_domain_target(domain_ctx, demand_only);
+            if (domain_ctx->allocated >= target) {
+                continue;
+            }
+
+            share = get_domain_share(
+                domain_ctx, budget, weight_sum, equal_weights);
+            if (share >= (target - domain_ctx->allocated)) {
+                distributed += target - domain_ctx->allocated;
+                domain_ctx->allocated = target;
+                saturated = true;
+            }
+        }
+
+        if (saturated) {
+            budget -= distributed;
+            continue;
+        }
+
+        /* No domain is satisfied by its share, every domain takes it */
+        for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+            domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+            if (domain_ctx->allocated >=
+                get_domain_target(domain_ctx, demand_only)) {
+                continue;
+            }
+
+            share = get_domain_share(
+                domain_ctx, budget, weight_sum, equal_weights);
+            domain_ctx->allocated += share;
+            distributed += share;
+        }
+
+        budget -= distributed;
+        break;
+    }
+
+    return budget;
+}
+
+/*
+ * Power allocation phase API
+ */
+
+static int power_allocator_allocate(void)
+{
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+    unsigned int idx;
+    uint64_t lower_sum = 0;
+    uint32_t budget = power_allocator_ctx.total_budget;
+
+    for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+        domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+        apply_pending_cap(idx, domain_ctx);
+        update_domain_bounds(domain_ctx);
+        lower_sum += domain_ctx->lower;
+    }
+
+    /* The budget cannot cover the minimums, scale them down */
+    if (lower_sum > budget) {
+        for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+            domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+            domain_ctx->allocated =
+                (uint32_t)(((uint64_t)domain_ctx->lower * budget) / lower_sum);
+        }
+
+        return FWK_SUCCESS;
+    }
+
+    for (idx = 0; idx < power_allocator_ctx.domain_count; idx++) {
+        domain_ctx = &power_allocator_ctx.domain_ctx_table[idx];
+        domain_ctx->allocated = domain_ctx->lower;
+    }
+    budget -= (uint32_t)lower_sum;
+
+    /* Serve the demands first, then hand the rest out as headroom */
+    budget = share_budget(budget, true);
+    (void)share_budget(budget, false);
+
+    return FWK_SUCCESS;
+}
+
+static int power_allocator_run_phase(fwk_id_t id)
+{
+    return power_allocator_allocate();
+}
+
+static const struct interface_power_management_phase_api
+    power_allocator_allocate_api = {
+        .run = power_allocator_run_phase,
+    };
+
+/*
+ * Power allocator cap API
+ */
+
+static int power_allocator_get_cap(fwk_id_t domain_id, uint32_t *cap)
+{
+    int status;
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+
+    if (cap == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_domain_ctx(domain_id, &domain_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *cap = domain_ctx->cap;
+
+    return FWK_SUCCESS;
+}
+
+static int power_allocator_set_cap(fwk_id_t domain_id, uint32_t cap)
+{
+    int status;
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+
+    status = get_domain_ctx(domain_id, &domain_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (!domain_ctx->cap_pending && (domain_ctx->cap == cap)) {
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * Without allocation phase, nothing would apply a pending cap. The domain
+     * then keeps its maximum power, within the cap.
+     */
+    if (!power_allocator_ctx.allocate_phase_bound) {
+        apply_cap(fwk_id_get_element_idx(domain_id), domain_ctx, cap);
+        domain_ctx->allocated = domain_ctx->config->max_power;
+        if (cap != 0) {
+            domain_ctx->allocated = FWK_MIN(domain_ctx->allocated, cap);
+        }
+
+        return FWK_SUCCESS;
+    }
+
+    /* The cap is applied with the next allocation */
+    domain_ctx->pending_cap = cap;
+    domain_ctx->cap_pending = true;
+
+    return FWK_PENDING;
+}
+
+static const struct mod_power_allocator_api power_allocator_api = {
+    .get_cap = power_allocator_get_cap,
+    .set_cap = power_allocator_set_cap,
+};
+
+/*
+ * Power management limit API
+ */
+
+static int power_allocator_get_limit(fwk_id_t id, uint32_t *power_limit)
+{
+    int status;
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+
+    if (power_limit == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (is_module_id(id)) {
+        *power_limit = power_allocator_ctx.total_budget;
+        return FWK_SUCCESS;
+    }
+
+    status = get_domain_ctx(id, &domain_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *power_limit = domain_ctx->allocated;
+
+    return FWK_SUCCESS;
+}
+
+static int power_allocator_set_limit(fwk_id_t id, uint32_t power_limit)
+{
+    /* Only the total budget can be limited */
+    if (!is_module_id(id)) {
+        return FWK_E_PARAM;
+    }
+
+    power_allocator_ctx.total_budget = power_limit;
+
+    return FWK_SUCCESS;
+}
+
+static struct interface_power_management_api power_allocator_limit_api = {
+    .get_limit = power_allocator_get_limit,
+    .set_limit = power_allocator_set_limit,
+};
+
+/*
+ * Framework handlers
+ */
+
+static int power_allocator_init(
+    fwk_id_t module_id,
+    unsigned int element_count,
+    const void *data)
+{
+    const struct mod_power_allocator_config *config = data;
+
+    if ((element_count == 0) || (config == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    power_allocator_ctx.domain_count = element_count;
+    power_allocator_ctx.total_budget = config->total_budget;
+    power_allocator_ctx.domain_ctx_table = fwk_mm_calloc(
+        element_count, sizeof(struct mod_power_allocator_domain_ctx));
+
+    return FWK_SUCCESS;
+}
+
+static int power_allocator_element_init(
+    fwk_id_t element_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+    const struct mod_power_allocator_domain_config *config = data;
+
+    if ((config == NULL) || (config->min_power > config->max_power)) {
+        return FWK_E_PARAM;
+    }
+
+    domain_ctx = &power_allocator_ctx
+                      .domain_ctx_table[fwk_id_get_element_idx(element_id)];
+    domain_ctx->config = config;
+    domain_ctx->allocated = config->max_power;
+
+    return FWK_SUCCESS;
+}
+
+static int power_allocator_bind(fwk_id_t id, unsigned int round)
+{
+    struct mod_power_allocator_domain_ctx *domain_ctx;
+
+    if ((round != 0) || !fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
+        return FWK_SUCCESS;
+    }
+
+    domain_ctx =
+        &power_allocator_ctx.domain_ctx_table[fwk_id_get_element_idx(id)];
+
+    if (fwk_id_is_equal(domain_ctx->config->demand_source_id, FWK_ID_NONE)) {
+        return FWK_SUCCESS;
+    }
+
+    return fwk_module_bind(
+        domain_ctx->config->demand_source_id,
+        domain_ctx->config->demand_api_id,
+        &domain_ctx->demand_api);
+}
+
+static int power_allocator_process_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    if (api == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    switch ((enum mod_power_allocator_api_idx)fwk_id_get_api_idx(api_id)) {
+    case MOD_POWER_ALLOCATOR_API_IDX_CAP:
+        *api = &power_allocator_api;
+        break;
+
+    case MOD_POWER_ALLOCATOR_API_IDX_ALLOCATE:
+#ifdef BUILD_HAS_NOTIFICATION
+        /* The caps applied by the phase complete with CAP_CHANGED */
+        power_allocator_ctx.allocate_phase_bound = true;
+        *api = &power_allocator_allocate_api;
+        break;
+#else
+        return FWK_E_SUPPORT;
+#endif
+
+    case MOD_POWER_ALLOCATOR_API_IDX_LIMIT:
+        *api = &power_allocator_limit_api;
+        break;
+
+    default:
+        return FWK_E_PARAM;
+    }
+
+    return FWK_SUCCESS;
+}
+
+const struct fwk_module module_power_allocator = {
+    .type = FWK_MODULE_TYPE_SERVICE,
+    .api_count = (unsigned int)MOD_POWER_ALLOCATOR_API_IDX_COUNT,
+#ifdef BUILD_HAS_NOTIFICATION
+    .notification_count =
+        (unsigned int)MOD_POWER_ALLOCATOR_NOTIFICATION_IDX_COUNT,
+#endif
+    .init = power_allocator_init,
+    .element_init = power_allocator_element_init,
+    .bind = power_allocator_bind,
+    .process_bind_request = power_allocator_process_bind_request,
+};
@@ -0,0 +1,52 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_power_allocator.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+enum power_allocator_test_domain_idx {
+    POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG,
+    POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE,
+    POWER_ALLOCATOR_TEST_DOMAIN_IDX_GPU,
+    POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT,
+};
+
+#define POWER_ALLOCATOR_TEST_DEMAND_API_ID \
+    FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_DEMAND_SOURCE, 0)
+
+static const struct mod_power_allocator_config power_allocator_config = {
+    .total_budget = 160,
+};
+
+static const struct mod_power_allocator_domain_config
+    power_allocator_domain_config[POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT] = {
+        [POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = {
+            .min_power = 10,
+            .max_power = 100,
+            .weight = 2,
+            .demand_source_id =
+                FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DEMAND_SOURCE, 0),
+            .demand_api_id = POWER_ALLOCATOR_TEST_DEMAND_API_ID,
+        },
+        [POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = {
+            .min_power = 10,
+            .max_power = 100,
+            .weight = 1,
+            .demand_source_id =
+                FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DEMAND_SOURCE, 1),
+            .demand_api_id = POWER_ALLOCATOR_TEST_DEMAND_API_ID,
+        },
+        [POWER_ALLOCATOR_TEST_DOMAIN_IDX_GPU] = {
+            .min_power = 0,
+            .max_power = 50,
+            .weight = 1,
+            .demand_source_id = FWK_ID_NONE_INIT,
+        },
+    };
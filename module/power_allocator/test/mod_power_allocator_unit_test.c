@@ -0,0 +1,430 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config_power_allocator.h"
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+
+#include <interface_power_management.h>
+
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TEST_DOMAIN_ID(IDX) FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_ALLOCATOR, IDX)
+#define TEST_MODULE_ID      FWK_ID_MODULE(FWK_MODULE_IDX_POWER_ALLOCATOR)
+
+static struct mod_power_allocator_domain_ctx
+    domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT];
+
+static uint32_t fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT];
+static int fake_demand_status;
+
+static int fake_get_demand(fwk_id_t id, uint32_t *demand)
+{
+    *demand = fake_demand[fwk_id_get_element_idx(id)];
+
+    return fake_demand_status;
+}
+
+static const struct mod_power_allocator_demand_api fake_demand_api = {
+    .get_demand = fake_get_demand,
+};
+
+void setUp(void)
+{
+    unsigned int idx;
+    int status;
+
+    memset(&power_allocator_ctx, 0, sizeof(power_allocator_ctx));
+    memset(domain_ctx_table, 0, sizeof(domain_ctx_table));
+    memset(fake_demand, 0, sizeof(fake_demand));
+    fake_demand_status = FWK_SUCCESS;
+
+    fwk_mm_calloc_ExpectAndReturn(
+        POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT,
+        sizeof(struct mod_power_allocator_domain_ctx),
+        domain_ctx_table);
+    status = power_allocator_init(
+        TEST_MODULE_ID,
+        POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT,
+        &power_allocator_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    for (idx = 0; idx < POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT; idx++) {
+        status = power_allocator_element_init(
+            TEST_DOMAIN_ID(idx), 0, &power_allocator_domain_config[idx]);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG].demand_api =
+        &fake_demand_api;
+    domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE].demand_api =
+        &fake_demand_api;
+}
+
+void tearDown(void)
+{
+    Mockfwk_mm_Verify();
+    Mockfwk_mm_Destroy();
+    Mockfwk_module_Verify();
+    Mockfwk_module_Destroy();
+    Mockfwk_notification_Verify();
+    Mockfwk_notification_Destroy();
+}
+
+static void assert_allocation(uint32_t big, uint32_t little, uint32_t gpu)
+{
+    TEST_ASSERT_EQUAL(
+        big, domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG].allocated);
+    TEST_ASSERT_EQUAL(
+        little,
+        domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE].allocated);
+    TEST_ASSERT_EQUAL(
+        gpu, domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_GPU].allocated);
+}
+
+void test_power_allocator_init_invalid_params(void)
+{
+    int status;
+
+    status = power_allocator_init(TEST_MODULE_ID, 0, &power_allocator_config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = power_allocator_init(
+        TEST_MODULE_ID, POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_allocator_element_init_invalid_bounds(void)
+{
+    int status;
+    const struct mod_power_allocator_domain_config config = {
+        .min_power = 20,
+        .max_power = 10,
+    };
+
+    status = power_allocator_element_init(TEST_DOMAIN_ID(0), 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_allocator_bind_demand_source(void)
+{
+    int status;
+    const struct mod_power_allocator_domain_config *config =
+        &power_allocator_domain_config[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG];
+
+    fwk_module_bind_ExpectAndReturn(
+        config->demand_source_id,
+        config->demand_api_id,
+        &domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG].demand_api,
+        FWK_SUCCESS);
+
+    status = power_allocator_bind(
+        TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG), 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* No demand source to bind to */
+    status = power_allocator_bind(
+        TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_GPU), 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_allocator_allocate_by_weight(void)
+{
+    int status;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Minimums of 20 then 140 shared by weight */
+    assert_allocation(80, 45, 35);
+}
+
+void test_power_allocator_allocate_redistributes_unused_budget(void)
+{
+    int status;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 20;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The budget the big domain does not need goes to the others */
+    assert_allocation(20, 90, 50);
+}
+
+void test_power_allocator_allocate_headroom(void)
+{
+    int status;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 20;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 30;
+    power_allocator_ctx.total_budget = 300;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The budget left once the demands are served is not stranded */
+    assert_allocation(100, 100, 50);
+}
+
+void test_power_allocator_allocate_budget_below_minimums(void)
+{
+    int status;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+    power_allocator_ctx.total_budget = 10;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    assert_allocation(5, 5, 0);
+}
+
+void test_power_allocator_allocate_zero_weight(void)
+{
+    int status;
+    const struct mod_power_allocator_domain_config gpu_config = {
+        .min_power = 0,
+        .max_power = 50,
+        .weight = 0,
+        .demand_source_id = FWK_ID_NONE_INIT,
+    };
+
+    domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_GPU].config = &gpu_config;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+    power_allocator_ctx.total_budget = 230;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The zero weight domain only gets what the others do not need */
+    assert_allocation(100, 100, 30);
+}
+
+void test_power_allocator_allocate_demand_error(void)
+{
+    int status;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 10;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 10;
+    fake_demand_status = FWK_E_DEVICE;
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Domains failing to report a demand ask for their maximum */
+    assert_allocation(80, 45, 35);
+}
+
+static void bind_allocate_phase(void)
+{
+    int status;
+    const void *api;
+
+    status = power_allocator_process_bind_request(
+        TEST_MODULE_ID,
+        TEST_MODULE_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_ALLOCATOR,
+            MOD_POWER_ALLOCATOR_API_IDX_ALLOCATE),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(&power_allocator_allocate_api, api);
+}
+
+void test_power_allocator_set_cap_applied_on_allocation(void)
+{
+    int status;
+    uint32_t cap;
+    fwk_id_t id = TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG);
+
+    bind_allocate_phase();
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+
+    status = power_allocator_set_cap(id, 40);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    status = power_allocator_get_cap(id, &cap);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, cap);
+
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_allocator_get_cap(id, &cap);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(40, cap);
+    assert_allocation(40, 70, 50);
+
+    /* Setting the same cap again completes immediately */
+    status = power_allocator_set_cap(id, 40);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_allocator_cap_below_minimum(void)
+{
+    int status;
+    fwk_id_t id = TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE);
+
+    bind_allocate_phase();
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+
+    status = power_allocator_set_cap(id, 5);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(
+        5, domain_ctx_table[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE].allocated);
+}
+
+void test_power_allocator_set_cap_without_allocate_phase(void)
+{
+    int status;
+    uint32_t cap;
+    uint32_t limit;
+    fwk_id_t id = TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG);
+
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_allocator_set_cap(id, 40);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_allocator_get_cap(id, &cap);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(40, cap);
+
+    status = power_allocator_get_limit(id, &limit);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(40, limit);
+
+    /* Removing the cap gives the domain its maximum power back */
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_allocator_set_cap(id, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_allocator_get_limit(id, &limit);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(
+        power_allocator_domain_config[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG]
+            .max_power,
+        limit);
+}
+
+void test_power_allocator_cap_invalid_domain(void)
+{
+    int status;
+    uint32_t cap;
+
+    status = power_allocator_get_cap(
+        TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_COUNT), &cap);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = power_allocator_set_cap(TEST_MODULE_ID, 10);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_allocator_limit_api(void)
+{
+    int status;
+    uint32_t limit;
+
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_BIG] = 100;
+    fake_demand[POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE] = 100;
+
+    status = power_allocator_get_limit(TEST_MODULE_ID, &limit);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(power_allocator_config.total_budget, limit);
+
+    status = power_allocator_set_limit(TEST_MODULE_ID, 300);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_allocator_allocate();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_allocator_get_limit(
+        TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE), &limit);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(100, limit);
+
+    status = power_allocator_set_limit(
+        TEST_DOMAIN_ID(POWER_ALLOCATOR_TEST_DOMAIN_IDX_LITTLE), 10);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_allocator_process_bind_request(void)
+{
+    int status;
+    const void *api;
+
+    status = power_allocator_process_bind_request(
+        TEST_MODULE_ID,
+        TEST_MODULE_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_ALLOCATOR, MOD_POWER_ALLOCATOR_API_IDX_LIMIT),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(&power_allocator_limit_api, api);
+
+    status = power_allocator_process_bind_request(
+        TEST_MODULE_ID,
+        TEST_MODULE_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_ALLOCATOR, MOD_POWER_ALLOCATOR_API_IDX_COUNT),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int power_allocator_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_power_allocator_init_invalid_params);
+    RUN_TEST(test_power_allocator_element_init_invalid_bounds);
+    RUN_TEST(test_power_allocator_bind_demand_source);
+    RUN_TEST(test_power_allocator_allocate_by_weight);
+    RUN_TEST(test_power_allocator_allocate_redistributes_unused_budget);
+    RUN_TEST(test_power_allocator_allocate_headroom);
+    RUN_TEST(test_power_allocator_allocate_budget_below_minimums);
+    RUN_TEST(test_power_allocator_allocate_zero_weight);
+    RUN_TEST(test_power_allocator_allocate_demand_error);
+    RUN_TEST(test_power_allocator_set_cap_applied_on_allocation);
+    RUN_TEST(test_power_allocator_cap_below_minimum);
+    RUN_TEST(test_power_allocator_set_cap_without_allocate_phase);
+    RUN_TEST(test_power_allocator_cap_invalid_domain);
+    RUN_TEST(test_power_allocator_limit_api);
+    RUN_TEST(test_power_allocator_process_bind_request);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_allocator_test_main();
+}
+#endif
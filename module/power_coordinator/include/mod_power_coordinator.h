@@ -12,6 +12,7 @@
 #define MOD_POWER_COORDINATOR_H
 
 #include <fwk_id.h>
+#include <fwk_time.h>
 
 #include <stdint.h>
 
@@ -29,6 +30,81 @@
  * \{
  */
 
+/*!
+ * \brief Control loop phases, run in this order in each period.
+ */
+enum mod_power_coordinator_phase {
+    /*! Sample the measurements, e.g. power meters and activity counters. */
+    MOD_POWER_COORDINATOR_PHASE_SAMPLE,
+
+    /*! Allocate the power budget, e.g. power allocator. */
+    MOD_POWER_COORDINATOR_PHASE_ALLOCATE,
+
+    /*! Compute the limits, e.g. thermal, power capping, metrics analyzer. */
+    MOD_POWER_COORDINATOR_PHASE_LIMIT,
+
+    /*! Apply the limits, e.g. performance controller. */
+    MOD_POWER_COORDINATOR_PHASE_APPLY,
+
+    /*! Number of phases. */
+    MOD_POWER_COORDINATOR_PHASE_COUNT,
+};
+
+/*!
+ * \brief Power coordinator module configuration.
+ */
+struct mod_power_coordinator_config {
+    /*!
+     * \brief Initial coordinator period, expressed in microseconds.
+     *
+     * \details The period timer has a millisecond resolution, the period
+     *      must be at least one millisecond and is rounded down to the
+     *      millisecond.
+     */
+    uint32_t period;
+
+    /*!
+     * \brief Identifier of the timer alarm driving the period.
+     */
+    fwk_id_t alarm_id;
+};
+
+/*!
+ * \brief Power coordinator participant configuration.
+ *
+ * \details Each element registers one participant in a control loop phase.
+ *      The participants of a phase are run in the order of the elements.
+ */
+struct mod_power_coordinator_participant_config {
+    /*! Phase the participant runs in */
+    enum mod_power_coordinator_phase phase;
+
+    /*!
+     * \brief Identifier of the participant.
+     *
+     * \details The phase API is bound from this identifier and the phase is
+     *      run with it.
+     */
+    fwk_id_t participant_id;
+
+    /*!
+     * \brief Identifier of the participant API implementing
+     *      ::interface_power_management_phase_api.
+     */
+    fwk_id_t participant_api_id;
+};
+
+/*!
+ * \brief Timing of a control loop phase.
+ */
+struct mod_power_coordinator_phase_timing {
+    /*! Duration of the phase in the last period */
+    fwk_duration_ns_t last;
+
+    /*! Longest duration of the phase since the coordinator started */
+    fwk_duration_ns_t max;
+};
+
 /*!
  * \brief Power coordinator interface.
  */
@@ -37,7 +113,7 @@ struct mod_power_coordinator_api {
      * \brief Get the coordinator period.
      *
      * \param id Coordinator ID.
-     * \param[out] period The coordinator period.
+     * \param[out] period The coordinator period, expressed in microseconds.
      *
      * \retval ::FWK_SUCCESS The coordinator period is returned successfully.
      */
@@ -47,11 +123,27 @@ struct mod_power_coordinator_api {
      * \brief Set the coordinator period.
      *
      * \param id Coordinator ID.
-     * \param period The coordinator period.
+     * \param period The coordinator period, expressed in microseconds.
      *
      * \retval ::FWK_SUCCESS The coordinator period is set successfully.
+     * \retval ::FWK_E_RANGE The period is shorter than one millisecond.
      */
     int (*set_coordinator_period)(fwk_id_t id, uint32_t period);
+
+    /*!
+     * \brief Get the timing of a control loop phase.
+     *
+     * \param id Coordinator ID.
+     * \param phase Control loop phase.
+     * \param[out] timing Timing of the phase.
+     *
+     * \retval ::FWK_SUCCESS The timing is returned successfully.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*get_phase_timing)(
+        fwk_id_t id,
+        enum mod_power_coordinator_phase phase,
+        struct mod_power_coordinator_phase_timing *timing);
 };
 
 /*!
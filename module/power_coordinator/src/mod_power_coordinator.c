@@ -0,0 +1,421 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Power coordinator module.
+ */
+
+#include <mod_power_coordinator.h>
+#include <mod_timer.h>
+
+#include <interface_power_management.h>
+
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_notification.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Power coordinator events */
+enum mod_power_coordinator_event_idx {
+    MOD_POWER_COORDINATOR_EVENT_IDX_PERIOD,
+    MOD_POWER_COORDINATOR_EVENT_IDX_COUNT,
+};
+
+static const fwk_id_t mod_power_coordinator_event_id_period =
+    FWK_ID_EVENT_INIT(
+        FWK_MODULE_IDX_POWER_COORDINATOR,
+        MOD_POWER_COORDINATOR_EVENT_IDX_PERIOD);
+
+/* The period is expressed in microseconds, the alarm in milliseconds */
+#define MOD_POWER_COORDINATOR_US_PER_MS 1000
+
+/* Power coordinator participant context */
+struct mod_power_coordinator_participant_ctx {
+    /* Participant configuration */
+    const struct mod_power_coordinator_participant_config *config;
+
+    /* Participant phase API */
+    const struct interface_power_management_phase_api *phase_api;
+};
+
+/* Power coordinator module context */
+struct mod_power_coordinator_ctx {
+    /* Module configuration */
+    const struct mod_power_coordinator_config *config;
+
+    /* Table of participant contexts */
+    struct mod_power_coordinator_participant_ctx *participant_ctx_table;
+
+    /* Number of participants */
+    unsigned int participant_count;
+
+    /* Participant indices sorted by phase */
+    unsigned int *run_order;
+
+    /* Index in the run order of the first participant of each phase */
+    unsigned int phase_start[MOD_POWER_COORDINATOR_PHASE_COUNT + 1];
+
+    /* Timing of each phase */
+    struct mod_power_coordinator_phase_timing
+        phase_timing[MOD_POWER_COORDINATOR_PHASE_COUNT];
+
+    /* Coordinator period, in microseconds */
+    uint32_t period;
+
+    /* The period alarm is running */
+    bool started;
+
+    /* Timer alarm API */
+    const struct mod_timer_alarm_api *alarm_api;
+};
+
+static struct mod_power_coordinator_ctx power_coordinator_ctx;
+
+/*
+ * Helper functions
+ */
+
+static bool is_coordinator_id(fwk_id_t id)
+{
+    return fwk_id_get_module_idx(id) == FWK_MODULE_IDX_POWER_COORDINATOR;
+}
+
+static void period_alarm_callback(uintptr_t param)
+{
+    int status;
+    struct fwk_event_light event = {
+        .id = mod_power_coordinator_event_id_period,
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_COORDINATOR),
+        .target_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_COORDINATOR),
+    };
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PWR-COORD] %s @%d", __func__, __LINE__);
+    }
+}
+
+static int start_period_alarm(void)
+{
+    return power_coordinator_ctx.alarm_api->start(
+        power_coordinator_ctx.config->alarm_id,
+        power_coordinator_ctx.period / MOD_POWER_COORDINATOR_US_PER_MS,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        period_alarm_callback,
+        (uintptr_t)0);
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+static void notify_period_changed(void)
+{
+    unsigned int count;
+    int status;
+    struct fwk_event notification = {
+        .id = FWK_ID_NOTIFICATION_INIT(
+            FWK_MODULE_IDX_POWER_COORDINATOR,
+            MOD_POWER_COORDINATOR_NOTIFICATION_IDX_PERIOD_CHANGED),
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_COORDINATOR),
+    };
+
+    status = fwk_notification_notify(&notification, &count);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PWR-COORD] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
+/* Sort the participants by phase, keeping the element order within a phase */
+static void build_run_order(void)
+{
+    struct mod_power_coordinator_participant_ctx *participant_ctx;
+    unsigned int next[MOD_POWER_COORDINATOR_PHASE_COUNT];
+    unsigned int phase;
+    unsigned int idx;
+
+    for (idx = 0; idx < power_coordinator_ctx.participant_count; idx++) {
+        participant_ctx = &power_coordinator_ctx.participant_ctx_table[idx];
+        power_coordinator_ctx.phase_start[participant_ctx->config->phase + 1]++;
+    }
+
+    for (phase = 0; phase < MOD_POWER_COORDINATOR_PHASE_COUNT; phase++) {
+        power_coordinator_ctx.phase_start[phase + 1] +=
+            power_coordinator_ctx.phase_start[phase];
+        next[phase] = power_coordinator_ctx.phase_start[phase];
+    }
+
+    for (idx = 0; idx < power_coordinator_ctx.participant_count; idx++) {
+        participant_ctx = &power_coordinator_ctx.participant_ctx_table[idx];
+        phase = participant_ctx->config->phase;
+        power_coordinator_ctx.run_order[next[phase]++] = idx;
+    }
+}
+
+static void run_phase(enum mod_power_coordinator_phase phase)
+{
+    struct mod_power_coordinator_participant_ctx *participant_ctx;
+    struct mod_power_coordinator_phase_timing *timing;
+    fwk_timestamp_t start;
+    unsigned int order_idx;
+    int status;
+
+    start = fwk_time_current();
+
+    for (order_idx = power_coordinator_ctx.phase_start[phase];
+         order_idx < power_coordinator_ctx.phase_start[phase + 1];
+         order_idx++) {
+        participant_ctx =
+            &power_coordinator_ctx
+                 .participant_ctx_table[power_coordinator_ctx
+                                            .run_order[order_idx]];
+
+        status = participant_ctx->phase_api->run(
+            participant_ctx->config->participant_id);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG(
+                "[PWR-COORD] Phase %u participant %u failed",
+                (unsigned int)phase,
+                power_coordinator_ctx.run_order[order_idx]);
+        }
+    }
+
+    timing = &power_coordinator_ctx.phase_timing[phase];
+    timing->last = fwk_time_duration(start, fwk_time_current());
+    timing->max = FWK_MAX(timing->max, timing->last);
+}
+
+/*
+ * Power coordinator API
+ */
+
+static int power_coordinator_get_period(fwk_id_t id, uint32_t *period)
+{
+    if ((period == NULL) || !is_coordinator_id(id)) {
+        return FWK_E_PARAM;
+    }
+
+    *period = power_coordinator_ctx.period;
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_set_period(fwk_id_t id, uint32_t period)
+{
+    int status;
+
+    if (!is_coordinator_id(id)) {
+        return FWK_E_PARAM;
+    }
+
+    if (period < MOD_POWER_COORDINATOR_US_PER_MS) {
+        return FWK_E_RANGE;
+    }
+
+    period -= period % MOD_POWER_COORDINATOR_US_PER_MS;
+    if (period == power_coordinator_ctx.period) {
+        return FWK_SUCCESS;
+    }
+
+    power_coordinator_ctx.period = period;
+
+    if (power_coordinator_ctx.started) {
+        status = start_period_alarm();
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+#ifdef BUILD_HAS_NOTIFICATION
+    notify_period_changed();
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_get_phase_timing(
+    fwk_id_t id,
+    enum mod_power_coordinator_phase phase,
+    struct mod_power_coordinator_phase_timing *timing)
+{
+    if ((timing == NULL) || !is_coordinator_id(id) ||
+        (phase >= MOD_POWER_COORDINATOR_PHASE_COUNT)) {
+        return FWK_E_PARAM;
+    }
+
+    *timing = power_coordinator_ctx.phase_timing[phase];
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_power_coordinator_api power_coordinator_api = {
+    .get_coordinator_period = power_coordinator_get_period,
+    .set_coordinator_period = power_coordinator_set_period,
+    .get_phase_timing = power_coordinator_get_phase_timing,
+};
+
+/*
+ * Framework handlers
+ */
+
+static int power_coordinator_init(
+    fwk_id_t module_id,
+    unsigned int element_count,
+    const void *data)
+{
+    const struct mod_power_coordinator_config *config = data;
+
+    if ((config == NULL) ||
+        (config->period < MOD_POWER_COORDINATOR_US_PER_MS)) {
+        return FWK_E_PARAM;
+    }
+
+    power_coordinator_ctx.config = config;
+    power_coordinator_ctx.period =
+        config->period - (config->period % MOD_POWER_COORDINATOR_US_PER_MS);
+    power_coordinator_ctx.participant_count = element_count;
+
+    if (element_count != 0) {
+        power_coordinator_ctx.participant_ctx_table = fwk_mm_calloc(
+            element_count,
+            sizeof(struct mod_power_coordinator_participant_ctx));
+        power_coordinator_ctx.run_order =
+            fwk_mm_calloc(element_count, sizeof(unsigned int));
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_element_init(
+    fwk_id_t element_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    const struct mod_power_coordinator_participant_config *config = data;
+
+    if ((config == NULL) ||
+        (config->phase >= MOD_POWER_COORDINATOR_PHASE_COUNT)) {
+        return FWK_E_PARAM;
+    }
+
+    power_coordinator_ctx
+        .participant_ctx_table[fwk_id_get_element_idx(element_id)]
+        .config = config;
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_post_init(fwk_id_t module_id)
+{
+    build_run_order();
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_bind(fwk_id_t id, unsigned int round)
+{
+    struct mod_power_coordinator_participant_ctx *participant_ctx;
+
+    if (round != 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return fwk_module_bind(
+            power_coordinator_ctx.config->alarm_id,
+            MOD_TIMER_API_ID_ALARM,
+            &power_coordinator_ctx.alarm_api);
+    }
+
+    participant_ctx =
+        &power_coordinator_ctx
+             .participant_ctx_table[fwk_id_get_element_idx(id)];
+
+    return fwk_module_bind(
+        participant_ctx->config->participant_id,
+        participant_ctx->config->participant_api_id,
+        &participant_ctx->phase_api);
+}
+
+static int power_coordinator_process_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    if ((api == NULL) ||
+        !fwk_id_is_equal(
+            api_id,
+            FWK_ID_API(
+                FWK_MODULE_IDX_POWER_COORDINATOR,
+                MOD_POWER_COORDINATOR_API_IDX_PERIOD))) {
+        return FWK_E_PARAM;
+    }
+
+    *api = &power_coordinator_api;
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_start(fwk_id_t id)
+{
+    int status;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return FWK_SUCCESS;
+    }
+
+    status = start_period_alarm();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    power_coordinator_ctx.started = true;
+
+    return FWK_SUCCESS;
+}
+
+static int power_coordinator_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    unsigned int phase;
+
+    if (!fwk_id_is_equal(event->id, mod_power_coordinator_event_id_period)) {
+        return FWK_E_PARAM;
+    }
+
+    for (phase = 0; phase < MOD_POWER_COORDINATOR_PHASE_COUNT; phase++) {
+        run_phase((enum mod_power_coordinator_phase)phase);
+    }
+
+    return FWK_SUCCESS;
+}
+
+const struct fwk_module module_power_coordinator = {
+    .type = FWK_MODULE_TYPE_SERVICE,
+    .api_count = (unsigned int)MOD_POWER_COORDINATOR_API_IDX_COUNT,
+    .event_count = (unsigned int)MOD_POWER_COORDINATOR_EVENT_IDX_COUNT,
+#ifdef BUILD_HAS_NOTIFICATION
+    .notification_count =
+        (unsigned int)MOD_POWER_COORDINATOR_NOTIFICATION_IDX_COUNT,
+#endif
+    .init = power_coordinator_init,
+    .element_init = power_coordinator_element_init,
+    .post_init = power_coordinator_post_init,
+    .bind = power_coordinator_bind,
+    .start = power_coordinator_start,
+    .process_bind_request = power_coordinator_process_bind_request,
+    .process_event = power_coordinator_process_event,
+};
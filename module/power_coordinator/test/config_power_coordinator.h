@@ -0,0 +1,62 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_power_coordinator.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+/* Participants, registered out of phase order */
+enum power_coordinator_test_participant_idx {
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_CONTROLLER,
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_METER,
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ANALYZER,
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNTERS,
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ALLOCATOR,
+    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT,
+};
+
+#define POWER_COORDINATOR_TEST_PERIOD 10000
+
+#define POWER_COORDINATOR_TEST_PARTICIPANT(IDX, PHASE) \
+    { \
+        .phase = PHASE, \
+        .participant_id = \
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_PARTICIPANT, IDX), \
+        .participant_api_id = \
+            FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_PARTICIPANT, 0), \
+    }
+
+static const struct mod_power_coordinator_config power_coordinator_config = {
+    .period = POWER_COORDINATOR_TEST_PERIOD,
+    .alarm_id = FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0, 0),
+};
+
+static const struct mod_power_coordinator_participant_config
+    power_coordinator_participant_config
+        [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT] = {
+            [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_CONTROLLER] =
+                POWER_COORDINATOR_TEST_PARTICIPANT(
+                    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_CONTROLLER,
+                    MOD_POWER_COORDINATOR_PHASE_APPLY),
+            [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_METER] =
+                POWER_COORDINATOR_TEST_PARTICIPANT(
+                    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_METER,
+                    MOD_POWER_COORDINATOR_PHASE_SAMPLE),
+            [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ANALYZER] =
+                POWER_COORDINATOR_TEST_PARTICIPANT(
+                    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ANALYZER,
+                    MOD_POWER_COORDINATOR_PHASE_LIMIT),
+            [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNTERS] =
+                POWER_COORDINATOR_TEST_PARTICIPANT(
+                    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNTERS,
+                    MOD_POWER_COORDINATOR_PHASE_SAMPLE),
+            [POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ALLOCATOR] =
+                POWER_COORDINATOR_TEST_PARTICIPANT(
+                    POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ALLOCATOR,
+                    MOD_POWER_COORDINATOR_PHASE_ALLOCATE),
+        };
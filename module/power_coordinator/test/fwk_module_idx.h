@@ -0,0 +1,20 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FWK_MODULE_MODULE_IDX_H
+#define TEST_FWK_MODULE_MODULE_IDX_H
+
+#include <fwk_id.h>
+
+enum fwk_module_idx {
+    FWK_MODULE_IDX_POWER_COORDINATOR,
+    FWK_MODULE_IDX_FAKE_PARTICIPANT,
+    FWK_MODULE_IDX_TIMER,
+    FWK_MODULE_IDX_COUNT,
+};
+
+#endif /* TEST_FWK_MODULE_MODULE_IDX_H */
@@ -0,0 +1,377 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config_power_coordinator.h"
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_timer.h>
+
+#include <interface_power_management.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TEST_MODULE_ID FWK_ID_MODULE(FWK_MODULE_IDX_POWER_COORDINATOR)
+#define TEST_PARTICIPANT_ID(IDX) \
+    FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_COORDINATOR, IDX)
+
+static struct mod_power_coordinator_participant_ctx
+    participant_ctx_table[POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT];
+static unsigned int run_order[POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT];
+
+static unsigned int run_log[POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT];
+static unsigned int run_count;
+
+static unsigned int alarm_start_count;
+static unsigned int alarm_milliseconds;
+static enum mod_timer_alarm_type alarm_type;
+static void (*alarm_callback)(uintptr_t param);
+static uintptr_t alarm_param;
+
+static int fake_run(fwk_id_t id)
+{
+    run_log[run_count++] = fwk_id_get_element_idx(id);
+
+    return FWK_SUCCESS;
+}
+
+static const struct interface_power_management_phase_api fake_phase_api = {
+    .run = fake_run,
+};
+
+static int fake_alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    alarm_start_count++;
+    alarm_milliseconds = milliseconds;
+    alarm_type = type;
+    alarm_callback = callback;
+    alarm_param = param;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api fake_alarm_api = {
+    .start = fake_alarm_start,
+};
+
+void setUp(void)
+{
+    unsigned int idx;
+    int status;
+
+    memset(&power_coordinator_ctx, 0, sizeof(power_coordinator_ctx));
+    memset(participant_ctx_table, 0, sizeof(participant_ctx_table));
+    memset(run_order, 0, sizeof(run_order));
+    run_count = 0;
+    alarm_start_count = 0;
+
+    fwk_mm_calloc_ExpectAndReturn(
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT,
+        sizeof(struct mod_power_coordinator_participant_ctx),
+        participant_ctx_table);
+    fwk_mm_calloc_ExpectAndReturn(
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT,
+        sizeof(unsigned int),
+        run_order);
+    status = power_coordinator_init(
+        TEST_MODULE_ID,
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT,
+        &power_coordinator_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    for (idx = 0; idx < POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT; idx++) {
+        status = power_coordinator_element_init(
+            TEST_PARTICIPANT_ID(idx),
+            0,
+            &power_coordinator_participant_config[idx]);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        participant_ctx_table[idx].phase_api = &fake_phase_api;
+    }
+
+    status = power_coordinator_post_init(TEST_MODULE_ID);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    power_coordinator_ctx.alarm_api = &fake_alarm_api;
+}
+
+void tearDown(void)
+{
+    Mockfwk_mm_Verify();
+    Mockfwk_mm_Destroy();
+    Mockfwk_module_Verify();
+    Mockfwk_module_Destroy();
+    Mockfwk_time_Verify();
+    Mockfwk_time_Destroy();
+    Mockfwk_notification_Verify();
+    Mockfwk_notification_Destroy();
+    Mockfwk_core_internal_Verify();
+    Mockfwk_core_internal_Destroy();
+}
+
+static void expect_phase_timing(fwk_duration_ns_t duration)
+{
+    fwk_time_current_ExpectAndReturn(0);
+    fwk_time_current_ExpectAndReturn(duration);
+    fwk_time_duration_ExpectAndReturn(0, duration, duration);
+}
+
+static void run_period(void)
+{
+    int status;
+    struct fwk_event event = {
+        .id = mod_power_coordinator_event_id_period,
+        .target_id = TEST_MODULE_ID,
+    };
+
+    status = power_coordinator_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_coordinator_init_invalid_config(void)
+{
+    int status;
+    const struct mod_power_coordinator_config config = {
+        .period = 999,
+    };
+
+    status = power_coordinator_init(TEST_MODULE_ID, 0, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = power_coordinator_init(TEST_MODULE_ID, 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_coordinator_element_init_invalid_phase(void)
+{
+    int status;
+    const struct mod_power_coordinator_participant_config config = {
+        .phase = MOD_POWER_COORDINATOR_PHASE_COUNT,
+    };
+
+    status = power_coordinator_element_init(TEST_PARTICIPANT_ID(0), 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_coordinator_bind(void)
+{
+    int status;
+    unsigned int idx = POWER_COORDINATOR_TEST_PARTICIPANT_IDX_METER;
+
+    fwk_module_bind_ExpectAndReturn(
+        power_coordinator_config.alarm_id,
+        MOD_TIMER_API_ID_ALARM,
+        &power_coordinator_ctx.alarm_api,
+        FWK_SUCCESS);
+    status = power_coordinator_bind(TEST_MODULE_ID, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    fwk_module_bind_ExpectAndReturn(
+        power_coordinator_participant_config[idx].participant_id,
+        power_coordinator_participant_config[idx].participant_api_id,
+        &participant_ctx_table[idx].phase_api,
+        FWK_SUCCESS);
+    status = power_coordinator_bind(TEST_PARTICIPANT_ID(idx), 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_coordinator_start_period_alarm(void)
+{
+    int status;
+
+    status = power_coordinator_start(TEST_MODULE_ID);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, alarm_start_count);
+    TEST_ASSERT_EQUAL(
+        POWER_COORDINATOR_TEST_PERIOD / MOD_POWER_COORDINATOR_US_PER_MS,
+        alarm_milliseconds);
+    TEST_ASSERT_EQUAL(MOD_TIMER_ALARM_TYPE_PERIODIC, alarm_type);
+
+    /* The alarm callback defers the control loop to an event */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    alarm_callback(alarm_param);
+}
+
+void test_power_coordinator_run_phases_in_order(void)
+{
+    unsigned int phase;
+    const unsigned int expected_order[] = {
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_METER,
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNTERS,
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ALLOCATOR,
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_ANALYZER,
+        POWER_COORDINATOR_TEST_PARTICIPANT_IDX_CONTROLLER,
+    };
+
+    for (phase = 0; phase < MOD_POWER_COORDINATOR_PHASE_COUNT; phase++) {
+        expect_phase_timing(0);
+    }
+
+    run_period();
+
+    TEST_ASSERT_EQUAL(POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT, run_count);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(
+        expected_order, run_log, POWER_COORDINATOR_TEST_PARTICIPANT_IDX_COUNT);
+}
+
+void test_power_coordinator_phase_timing(void)
+{
+    int status;
+    struct mod_power_coordinator_phase_timing timing;
+
+    expect_phase_timing(FWK_US(30));
+    expect_phase_timing(FWK_US(20));
+    expect_phase_timing(FWK_US(10));
+    expect_phase_timing(FWK_US(5));
+    run_period();
+
+    expect_phase_timing(FWK_US(10));
+    expect_phase_timing(FWK_US(40));
+    expect_phase_timing(FWK_US(10));
+    expect_phase_timing(FWK_US(5));
+    run_period();
+
+    status = power_coordinator_get_phase_timing(
+        TEST_MODULE_ID, MOD_POWER_COORDINATOR_PHASE_SAMPLE, &timing);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(FWK_US(10), timing.last);
+    TEST_ASSERT_EQUAL_UINT64(FWK_US(30), timing.max);
+
+    status = power_coordinator_get_phase_timing(
+        TEST_MODULE_ID, MOD_POWER_COORDINATOR_PHASE_ALLOCATE, &timing);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(FWK_US(40), timing.last);
+    TEST_ASSERT_EQUAL_UINT64(FWK_US(40), timing.max);
+
+    status = power_coordinator_get_phase_timing(
+        TEST_MODULE_ID, MOD_POWER_COORDINATOR_PHASE_COUNT, &timing);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_coordinator_get_period(void)
+{
+    int status;
+    uint32_t period;
+
+    status = power_coordinator_get_period(TEST_PARTICIPANT_ID(0), &period);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(POWER_COORDINATOR_TEST_PERIOD, period);
+
+    status = power_coordinator_get_period(
+        FWK_ID_MODULE(FWK_MODULE_IDX_TIMER), &period);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_coordinator_set_period(void)
+{
+    int status;
+    uint32_t period;
+
+    status = power_coordinator_start(TEST_MODULE_ID);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The period is rounded down to the millisecond */
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_coordinator_set_period(TEST_MODULE_ID, 5500);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+    TEST_ASSERT_EQUAL(5, alarm_milliseconds);
+
+    status = power_coordinator_get_period(TEST_MODULE_ID, &period);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(5000, period);
+
+    /* Unchanged period */
+    status = power_coordinator_set_period(TEST_MODULE_ID, 5000);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, alarm_start_count);
+}
+
+void test_power_coordinator_set_period_before_start(void)
+{
+    int status;
+
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_coordinator_set_period(TEST_MODULE_ID, 20000);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, alarm_start_count);
+
+    status = power_coordinator_start(TEST_MODULE_ID);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(20, alarm_milliseconds);
+}
+
+void test_power_coordinator_set_period_out_of_range(void)
+{
+    int status;
+
+    status = power_coordinator_set_period(TEST_MODULE_ID, 999);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
+void test_power_coordinator_process_bind_request(void)
+{
+    int status;
+    const void *api;
+
+    status = power_coordinator_process_bind_request(
+        TEST_MODULE_ID,
+        TEST_MODULE_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_COORDINATOR,
+            MOD_POWER_COORDINATOR_API_IDX_PERIOD),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(&power_coordinator_api, api);
+
+    status = power_coordinator_process_bind_request(
+        TEST_MODULE_ID,
+        TEST_MODULE_ID,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_COORDINATOR,
+            MOD_POWER_COORDINATOR_API_IDX_COUNT),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int power_coordinator_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_power_coordinator_init_invalid_config);
+    RUN_TEST(test_power_coordinator_element_init_invalid_phase);
+    RUN_TEST(test_power_coordinator_bind);
+    RUN_TEST(test_power_coordinator_start_period_alarm);
+    RUN_TEST(test_power_coordinator_run_phases_in_order);
+    RUN_TEST(test_power_coordinator_phase_timing);
+    RUN_TEST(test_power_coordinator_get_period);
+    RUN_TEST(test_power_coordinator_set_period);
+    RUN_TEST(test_power_coordinator_set_period_before_start);
+    RUN_TEST(test_power_coordinator_set_period_out_of_range);
+    RUN_TEST(test_power_coordinator_process_bind_request);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_coordinator_test_main();
+}
+#endif
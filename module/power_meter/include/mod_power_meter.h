@@ -13,6 +13,8 @@
 
 #include <fwk_id.h>
 
+#include <stdint.h>
+
 /*!
  * \addtogroup GroupModules Modules
  * \{
@@ -36,8 +38,69 @@ struct mod_power_meter_dev_config {
     fwk_id_t driver_id;
     /*!
      * \brief API identifier of the driver.
+     *
+     * \details Set to ::FWK_ID_NONE when the driver does not implement the
+     *      driver API and reports the power through the driver input API
+     *      instead.
      */
     fwk_id_t driver_api_id;
+
+    /*!
+     * \brief Sample period.
+     *
+     * \details The period, expressed in milliseconds, at which the power is
+     *      read from the driver and accumulated into the energy counter. Zero
+     *      when the energy is only accumulated from the power reported by the
+     *      driver or read through the power meter API.
+     */
+    unsigned int sample_period;
+
+    /*!
+     * \brief Identifier of the timer alarm used to sample the driver.
+     *
+     * \details Only used when the sample period is not zero.
+     */
+    fwk_id_t alarm_id;
+
+    /*!
+     * \brief Address of the energy page.
+     *
+     * \details Optional address of a ::mod_power_meter_energy_page in memory
+     *      shared with the agents, to which the energy counter is exported.
+     *      Zero when the energy counter is not exported.
+     */
+    uintptr_t energy_page_address;
+
+    /*!
+     * \brief Energy unit multiplier.
+     *
+     * \details The power of ten applied to the energy counter to express it
+     *      in joules when read as a sensor. The energy counter is accumulated
+     *      in the power unit of the driver multiplied by milliseconds, so a
+     *      driver measuring milliwatts has an energy unit multiplier of -6.
+     */
+    int energy_unit_multiplier;
+};
+
+/*!
+ * \brief Energy page.
+ *
+ * \details Layout of the energy counter exported to the agents. The sequence
+ *      is odd while the page is being updated, readers must retry until they
+ *      read the same even sequence before and after reading the page.
+ */
+struct mod_power_meter_energy_page {
+    /*! Update sequence */
+    uint32_t sequence;
+
+    /*! Last power measured */
+    uint32_t power;
+
+    /*! Energy accumulated since the power meter started */
+    uint64_t energy;
+
+    /*! Time of the last update, expressed in nanoseconds */
+    uint64_t timestamp;
 };
 
 /*!
@@ -88,6 +151,41 @@ struct mod_power_meter_api {
         fwk_id_t id,
         uint32_t threshold_low,
         uint32_t threshold_high);
+
+    /*!
+     * \brief Get the accumulated energy.
+     *
+     * \details The energy counter is accumulated in the power unit of the
+     *      driver multiplied by milliseconds and does not wrap in practice.
+     *
+     * \param id Specific power meter device ID.
+     * \param[out] energy Energy accumulated since the power meter started.
+     *
+     * \retval ::FWK_SUCCESS The energy is returned successfully.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*get_energy)(fwk_id_t id, uint64_t *energy);
+};
+
+/*!
+ * \brief Power meter driver input interface.
+ *
+ * \details Used by the drivers measuring the power on their own schedule.
+ */
+struct mod_power_meter_driver_input_api {
+    /*!
+     * \brief Report a power measurement.
+     *
+     * \details The energy is accumulated assuming the previously reported
+     *      power was drawn until now.
+     *
+     * \param id Specific power meter device ID.
+     * \param power Power measured by the power meter device.
+     *
+     * \retval ::FWK_SUCCESS The power measurement is accounted for.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*report_power)(fwk_id_t id, uint32_t power);
 };
 
 /*!
@@ -97,6 +195,12 @@ enum mod_power_meter_api_idx {
     /*! Get power measurements */
     MOD_POWER_METER_API_IDX_MEASUREMENT,
 
+    /*! Report power measurements from the drivers */
+    MOD_POWER_METER_API_IDX_DRIVER_INPUT,
+
+    /*! Read the energy counter as a sensor driver */
+    MOD_POWER_METER_API_IDX_ENERGY_SENSOR,
+
     /*! Number of defined APIs. */
     MOD_POWER_METER_API_IDX_COUNT,
 };
@@ -112,6 +216,16 @@ enum mod_power_meter_notification_idx {
     MOD_POWER_METER_NOTIFICATION_IDX_COUNT,
 };
 
+/*!
+ * \brief Measurements changed notification parameters.
+ *
+ * \details The notification is sent from the power meter module identifier.
+ */
+struct mod_power_meter_notification_params {
+    /*! Identifier of the power meter device whose power changed */
+    fwk_id_t id;
+};
+
 /*!
  * \}
  */
@@ -0,0 +1,568 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Power meter module.
+ */
+
+#include <mod_power_meter.h>
+#include <mod_timer.h>
+#ifdef BUILD_HAS_MOD_SENSOR
+#    include <mod_sensor.h>
+#endif
+
+#include <fwk_assert.h>
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_notification.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Power meter events */
+enum mod_power_meter_event_idx {
+    MOD_POWER_METER_EVENT_IDX_SAMPLE,
+    MOD_POWER_METER_EVENT_IDX_COUNT,
+};
+
+static const fwk_id_t mod_power_meter_event_id_sample = FWK_ID_EVENT_INIT(
+    FWK_MODULE_IDX_POWER_METER,
+    MOD_POWER_METER_EVENT_IDX_SAMPLE);
+
+/* Power meter device context */
+struct mod_power_meter_dev_ctx {
+    /* Power meter device configuration */
+    const struct mod_power_meter_dev_config *config;
+
+    /* Driver API, NULL when the driver reports the power */
+    const struct mod_power_meter_driver_api *driver_api;
+
+    /* Energy page, NULL when the energy counter is not exported */
+    volatile struct mod_power_meter_energy_page *energy_page;
+
+    /* Energy accumulated since the power meter started */
+    uint64_t energy;
+
+    /*
+     * Energy not yet accounted for in the counter, in power unit times
+     * nanoseconds. Always lower than one millisecond worth of the power.
+     */
+    uint64_t energy_remainder;
+
+    /* Time of the last power measurement */
+    fwk_timestamp_t timestamp;
+
+    /* Last power measurement */
+    uint32_t power;
+
+    /* A power measurement has been accounted for */
+    bool measured;
+
+    /* Power change notification thresholds */
+    uint32_t threshold_low;
+    uint32_t threshold_high;
+};
+
+/* Power meter module context */
+struct mod_power_meter_ctx {
+    /* Table of power meter device contexts */
+    struct mod_power_meter_dev_ctx *dev_ctx_table;
+
+    /* Number of power meter devices */
+    unsigned int dev_count;
+
+    /* Timer alarm API */
+    const struct mod_timer_alarm_api *alarm_api;
+};
+
+static struct mod_power_meter_ctx power_meter_ctx;
+
+/*
+ * Helper functions
+ */
+
+static int get_dev_ctx(fwk_id_t id, struct mod_power_meter_dev_ctx **dev_ctx)
+{
+    unsigned int dev_idx;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT) ||
+        (fwk_id_get_module_idx(id) != FWK_MODULE_IDX_POWER_METER)) {
+        return FWK_E_PARAM;
+    }
+
+    dev_idx = fwk_id_get_element_idx(id);
+    if (dev_idx >= power_meter_ctx.dev_count) {
+        return FWK_E_PARAM;
+    }
+
+    *dev_ctx = &power_meter_ctx.dev_ctx_table[dev_idx];
+
+    return FWK_SUCCESS;
+}
+
+static bool power_outside_thresholds(
+    const struct mod_power_meter_dev_ctx *dev_ctx,
+    uint32_t power)
+{
+    return (power < dev_ctx->threshold_low) ||
+        (power > dev_ctx->threshold_high);
+}
+
+static void update_energy_page(struct mod_power_meter_dev_ctx *dev_ctx)
+{
+    volatile struct mod_power_meter_energy_page *page = dev_ctx->energy_page;
+
+    if (page == NULL) {
+        return;
+    }
+
+    /*
+     * The barriers keep the odd sequence visible to the agents before the
+     * payload, and the payload before the even sequence.
+     */
+    page->sequence++;
+    __sync_synchronize();
+    page->power = dev_ctx->power;
+    page->energy = dev_ctx->energy;
+    page->timestamp = dev_ctx->timestamp;
+    __sync_synchronize();
+    page->sequence++;
+}
+
+#ifdef BUILD_HAS_NOTIFICATION
+static void notify_measurements_changed(fwk_id_t id)
+{
+    unsigned int count;
+    int status;
+    struct fwk_event notification = {
+        .id = FWK_ID_NOTIFICATION_INIT(
+            FWK_MODULE_IDX_POWER_METER,
+            MOD_POWER_METER_NOTIFICATION_IDX_MEASUREMENTS_CHANGED),
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_METER),
+    };
+    struct mod_power_meter_notification_params *params =
+        (struct mod_power_meter_notification_params *)notification.params;
+
+    params->id = id;
+
+    status = fwk_notification_notify(&notification, &count);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PWR-METER] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
+/*
+ * Account for a new power measurement. The previous measurement is assumed to
+ * have been drawn since it was taken.
+ */
+static void accumulate_power(
+    fwk_id_t id,
+    struct mod_power_meter_dev_ctx *dev_ctx,
+    uint32_t power)
+{
+    fwk_timestamp_t now;
+    fwk_duration_ns_t elapsed;
+    uint64_t energy;
+    bool was_outside;
+
+    now = fwk_time_current();
+    was_outside =
+        dev_ctx->measured && power_outside_thresholds(dev_ctx, dev_ctx->power);
+
+    if (dev_ctx->measured) {
+        elapsed = fwk_time_duration(dev_ctx->timestamp, now);
+        /*
+         * Whole milliseconds are accounted for straight away. The rest of the
+         * interval is accumulated in nanoseconds so that no part of it is
+         * dropped.
+         */
+        dev_ctx->energy += (uint64_t)dev_ctx->power * (elapsed / FWK_MS(1));
+
+        energy = ((uint64_t)dev_ctx->power * (elapsed % FWK_MS(1))) +
+            dev_ctx->energy_remainder;
+
+        dev_ctx->energy += energy / FWK_MS(1);
+        dev_ctx->energy_remainder = energy % FWK_MS(1);
+    }
+
+    dev_ctx->power = power;
+    dev_ctx->timestamp = now;
+    dev_ctx->measured = true;
+
+    update_energy_page(dev_ctx);
+
+#ifdef BUILD_HAS_NOTIFICATION
+    /* Only notify when the power leaves the thresholds window */
+    if (power_outside_thresholds(dev_ctx, power) && !was_outside) {
+        notify_measurements_changed(id);
+    }
+#else
+    (void)id;
+    (void)was_outside;
+#endif
+}
+
+static int sample_power(fwk_id_t id, struct mod_power_meter_dev_ctx *dev_ctx)
+{
+    int status;
+    uint32_t power;
+
+    status = dev_ctx->driver_api->get_power(dev_ctx->config->driver_id, &power);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    accumulate_power(id, dev_ctx, power);
+
+    return FWK_SUCCESS;
+}
+
+static void sample_alarm_callback(uintptr_t param)
+{
+    int status;
+    struct fwk_event_light event = {
+        .id = mod_power_meter_event_id_sample,
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_METER),
+        .target_id =
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_METER, (unsigned int)param),
+    };
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[PWR-METER] %s @%d", __func__, __LINE__);
+    }
+}
+
+/*
+ * Power meter API
+ */
+
+static int power_meter_get_power(fwk_id_t id, uint32_t *power)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if (power == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_dev_ctx(id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* Polling the driver also feeds the energy counter */
+    if (dev_ctx->driver_api != NULL) {
+        status = sample_power(id, dev_ctx);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    } else if (!dev_ctx->measured) {
+        return FWK_E_STATE;
+    }
+
+    *power = dev_ctx->power;
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_set_power_change_notif_thresholds(
+    fwk_id_t id,
+    uint32_t threshold_low,
+    uint32_t threshold_high)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if (threshold_low > threshold_high) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_dev_ctx(id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    dev_ctx->threshold_low = threshold_low;
+    dev_ctx->threshold_high = threshold_high;
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_get_energy(fwk_id_t id, uint64_t *energy)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if (energy == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_dev_ctx(id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *energy = dev_ctx->energy;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_power_meter_api power_meter_api = {
+    .get_power = power_meter_get_power,
+    .set_power_change_notif_thresholds =
+        power_meter_set_power_change_notif_thresholds,
+    .get_energy = power_meter_get_energy,
+};
+
+/*
+ * Power meter driver input API
+ */
+
+static int power_meter_report_power(fwk_id_t id, uint32_t power)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    status = get_dev_ctx(id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    accumulate_power(id, dev_ctx, power);
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_power_meter_driver_input_api
+    power_meter_driver_input_api = {
+        .report_power = power_meter_report_power,
+    };
+
+/*
+ * Energy sensor driver API
+ */
+
+#ifdef BUILD_HAS_MOD_SENSOR
+static int power_meter_energy_get_value(fwk_id_t id, mod_sensor_value_t *value)
+{
+    int status;
+    uint64_t energy;
+
+    status = power_meter_get_energy(id, &energy);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *value = (mod_sensor_value_t)energy;
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_energy_get_info(
+    fwk_id_t id,
+    struct mod_sensor_info *info)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    status = get_dev_ctx(id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *info = (struct mod_sensor_info){
+        .type = MOD_SENSOR_TYPE_JOULES,
+        .update_interval = dev_ctx->config->sample_period,
+        .update_interval_multiplier = -3,
+        .unit_multiplier = dev_ctx->config->energy_unit_multiplier,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_sensor_driver_api power_meter_energy_sensor_api = {
+    .get_value = power_meter_energy_get_value,
+    .get_info = power_meter_energy_get_info,
+};
+#endif
+
+/*
+ * Framework handlers
+ */
+
+static int power_meter_init(
+    fwk_id_t module_id,
+    unsigned int element_count,
+    const void *data)
+{
+    if (element_count == 0) {
+        return FWK_E_PARAM;
+    }
+
+    power_meter_ctx.dev_count = element_count;
+    power_meter_ctx.dev_ctx_table =
+        fwk_mm_calloc(element_count, sizeof(struct mod_power_meter_dev_ctx));
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_element_init(
+    fwk_id_t element_id,
+    unsigned int sub_element_count,
+    const void *data)
+{
+    struct mod_power_meter_dev_ctx *dev_ctx;
+    const struct mod_power_meter_dev_config *config;
+
+    if (data == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    config = (const struct mod_power_meter_dev_config *)data;
+
+    /* Sampling needs a driver to read the power from */
+    if ((config->sample_period != 0) &&
+        fwk_id_is_equal(config->driver_api_id, FWK_ID_NONE)) {
+        return FWK_E_DATA;
+    }
+
+    dev_ctx =
+        &power_meter_ctx.dev_ctx_table[fwk_id_get_element_idx(element_id)];
+    dev_ctx->config = config;
+    dev_ctx->threshold_low = 0;
+    dev_ctx->threshold_high = UINT32_MAX;
+    dev_ctx->energy_page =
+        (volatile struct mod_power_meter_energy_page *)
+            config->energy_page_address;
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_bind(fwk_id_t id, unsigned int round)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if ((round != 0) || !fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
+        return FWK_SUCCESS;
+    }
+
+    dev_ctx = &power_meter_ctx.dev_ctx_table[fwk_id_get_element_idx(id)];
+
+    if (!fwk_id_is_equal(dev_ctx->config->driver_api_id, FWK_ID_NONE)) {
+        status = fwk_module_bind(
+            dev_ctx->config->driver_id,
+            dev_ctx->config->driver_api_id,
+            &dev_ctx->driver_api);
+        if (status != FWK_SUCCESS) {
+            return FWK_E_PANIC;
+        }
+    }
+
+    if (dev_ctx->config->sample_period != 0) {
+        return fwk_module_bind(
+            dev_ctx->config->alarm_id,
+            MOD_TIMER_API_ID_ALARM,
+            &power_meter_ctx.alarm_api);
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_process_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api)
+{
+    switch ((enum mod_power_meter_api_idx)fwk_id_get_api_idx(api_id)) {
+    case MOD_POWER_METER_API_IDX_MEASUREMENT:
+        *api = &power_meter_api;
+        break;
+
+    case MOD_POWER_METER_API_IDX_DRIVER_INPUT:
+        *api = &power_meter_driver_input_api;
+        break;
+
+#ifdef BUILD_HAS_MOD_SENSOR
+    case MOD_POWER_METER_API_IDX_ENERGY_SENSOR:
+        *api = &power_meter_energy_sensor_api;
+        break;
+#endif
+
+    default:
+        return FWK_E_SUPPORT;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int power_meter_start(fwk_id_t id)
+{
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT)) {
+        return FWK_SUCCESS;
+    }
+
+    dev_ctx = &power_meter_ctx.dev_ctx_table[fwk_id_get_element_idx(id)];
+
+    update_energy_page(dev_ctx);
+
+    if (dev_ctx->config->sample_period == 0) {
+        return FWK_SUCCESS;
+    }
+
+    return power_meter_ctx.alarm_api->start(
+        dev_ctx->config->alarm_id,
+        dev_ctx->config->sample_period,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        sample_alarm_callback,
+        (uintptr_t)fwk_id_get_element_idx(id));
+}
+
+static int power_meter_process_event(
+    const struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    int status;
+    struct mod_power_meter_dev_ctx *dev_ctx;
+
+    if (!fwk_id_is_equal(event->id, mod_power_meter_event_id_sample)) {
+        return FWK_E_PARAM;
+    }
+
+    status = get_dev_ctx(event->target_id, &dev_ctx);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    return sample_power(event->target_id, dev_ctx);
+}
+
+const struct fwk_module module_power_meter = {
+    .type = FWK_MODULE_TYPE_SERVICE,
+    .api_count = (unsigned int)MOD_POWER_METER_API_IDX_COUNT,
+    .event_count = (unsigned int)MOD_POWER_METER_EVENT_IDX_COUNT,
+#ifdef BUILD_HAS_NOTIFICATION
+    .notification_count = (unsigned int)MOD_POWER_METER_NOTIFICATION_IDX_COUNT,
+#endif
+    .init = power_meter_init,
+    .element_init = power_meter_element_init,
+    .bind = power_meter_bind,
+    .start = power_meter_start,
+    .process_bind_request = power_meter_process_bind_request,
+    .process_event = power_meter_process_event,
+};
@@ -0,0 +1,62 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_power_meter.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+enum power_meter_test_dev_idx {
+    POWER_METER_TEST_DEV_IDX_POLLED,
+    POWER_METER_TEST_DEV_IDX_SAMPLED,
+    POWER_METER_TEST_DEV_IDX_REPORTED,
+    POWER_METER_TEST_DEV_IDX_COUNT,
+};
+
+#define POWER_METER_TEST_SAMPLE_PERIOD 10
+
+static struct mod_power_meter_energy_page test_energy_page;
+
+static const struct fwk_element
+    power_meter_element_table[POWER_METER_TEST_DEV_IDX_COUNT + 1] = {
+    [POWER_METER_TEST_DEV_IDX_POLLED] = {
+        .name = "Polled power meter",
+        .data = &(const struct mod_power_meter_dev_config) {
+            .driver_id = FWK_ID_ELEMENT_INIT(
+                FWK_MODULE_IDX_FAKE_POWER_METER_DRIVER, 0),
+            .driver_api_id = FWK_ID_API_INIT(
+                FWK_MODULE_IDX_FAKE_POWER_METER_DRIVER, 0),
+            .alarm_id = FWK_ID_NONE_INIT,
+            .energy_page_address = (uintptr_t)&test_energy_page,
+            .energy_unit_multiplier = -6,
+        },
+    },
+    [POWER_METER_TEST_DEV_IDX_SAMPLED] = {
+        .name = "Sampled power meter",
+        .data = &(const struct mod_power_meter_dev_config) {
+            .driver_id = FWK_ID_ELEMENT_INIT(
+                FWK_MODULE_IDX_FAKE_POWER_METER_DRIVER, 1),
+            .driver_api_id = FWK_ID_API_INIT(
+                FWK_MODULE_IDX_FAKE_POWER_METER_DRIVER, 0),
+            .sample_period = POWER_METER_TEST_SAMPLE_PERIOD,
+            .alarm_id = FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0, 0),
+            .energy_unit_multiplier = -6,
+        },
+    },
+    [POWER_METER_TEST_DEV_IDX_REPORTED] = {
+        .name = "Reported power meter",
+        .data = &(const struct mod_power_meter_dev_config) {
+            .driver_id = FWK_ID_ELEMENT_INIT(
+                FWK_MODULE_IDX_FAKE_POWER_METER_DRIVER, 2),
+            .driver_api_id = FWK_ID_NONE_INIT,
+            .alarm_id = FWK_ID_NONE_INIT,
+            .energy_unit_multiplier = -6,
+        },
+    },
+    [POWER_METER_TEST_DEV_IDX_COUNT] = { 0 },
+};
@@ -0,0 +1,503 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config_power_meter.h"
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_timer.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define TEST_DEV_ID(IDX) FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_METER, IDX)
+
+static struct mod_power_meter_dev_ctx
+    dev_ctx_table[POWER_METER_TEST_DEV_IDX_COUNT];
+
+static uint32_t fake_power;
+
+static unsigned int alarm_start_count;
+static unsigned int alarm_milliseconds;
+static enum mod_timer_alarm_type alarm_type;
+static void (*alarm_callback)(uintptr_t param);
+static uintptr_t alarm_param;
+
+static int fake_get_power(fwk_id_t id, uint32_t *power)
+{
+    *power = fake_power;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_power_meter_driver_api fake_driver_api = {
+    .get_power = fake_get_power,
+};
+
+static int fake_alarm_start(
+    fwk_id_t alarm_id,
+    unsigned int milliseconds,
+    enum mod_timer_alarm_type type,
+    void (*callback)(uintptr_t param),
+    uintptr_t param)
+{
+    alarm_start_count++;
+    alarm_milliseconds = milliseconds;
+    alarm_type = type;
+    alarm_callback = callback;
+    alarm_param = param;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_timer_alarm_api fake_alarm_api = {
+    .start = fake_alarm_start,
+};
+
+void setUp(void)
+{
+    unsigned int idx;
+    int status;
+
+    memset(&power_meter_ctx, 0, sizeof(power_meter_ctx));
+    memset(dev_ctx_table, 0, sizeof(dev_ctx_table));
+    memset(&test_energy_page, 0, sizeof(test_energy_page));
+    fake_power = 0;
+    alarm_start_count = 0;
+
+    fwk_mm_calloc_ExpectAndReturn(
+        POWER_METER_TEST_DEV_IDX_COUNT,
+        sizeof(struct mod_power_meter_dev_ctx),
+        dev_ctx_table);
+    status = power_meter_init(
+        FWK_ID_MODULE(FWK_MODULE_IDX_POWER_METER),
+        POWER_METER_TEST_DEV_IDX_COUNT,
+        NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    for (idx = 0; idx < POWER_METER_TEST_DEV_IDX_COUNT; idx++) {
+        status = power_meter_element_init(
+            TEST_DEV_ID(idx), 0, power_meter_element_table[idx].data);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    dev_ctx_table[POWER_METER_TEST_DEV_IDX_POLLED].driver_api =
+        &fake_driver_api;
+    dev_ctx_table[POWER_METER_TEST_DEV_IDX_SAMPLED].driver_api =
+        &fake_driver_api;
+    power_meter_ctx.alarm_api = &fake_alarm_api;
+}
+
+void tearDown(void)
+{
+    Mockfwk_mm_Verify();
+    Mockfwk_mm_Destroy();
+    Mockfwk_module_Verify();
+    Mockfwk_module_Destroy();
+    Mockfwk_time_Verify();
+    Mockfwk_time_Destroy();
+    Mockfwk_notification_Verify();
+    Mockfwk_notification_Destroy();
+    Mockfwk_core_internal_Verify();
+    Mockfwk_core_internal_Destroy();
+}
+
+static void expect_measurement(
+    fwk_timestamp_t now,
+    bool measured,
+    fwk_duration_ns_t elapsed)
+{
+    fwk_time_current_ExpectAndReturn(now);
+    if (measured) {
+        fwk_time_duration_ExpectAnyArgsAndReturn(elapsed);
+    }
+}
+
+void test_power_meter_init_invalid_element_count(void)
+{
+    int status;
+
+    status =
+        power_meter_init(FWK_ID_MODULE(FWK_MODULE_IDX_POWER_METER), 0, NULL);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_meter_element_init_sampling_without_driver(void)
+{
+    int status;
+    const struct mod_power_meter_dev_config config = {
+        .driver_api_id = FWK_ID_NONE_INIT,
+        .sample_period = POWER_METER_TEST_SAMPLE_PERIOD,
+    };
+
+    status = power_meter_element_init(TEST_DEV_ID(0), 0, &config);
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+}
+
+void test_power_meter_bind_driver_and_alarm(void)
+{
+    int status;
+    const struct mod_power_meter_dev_config *config =
+        power_meter_element_table[POWER_METER_TEST_DEV_IDX_SAMPLED].data;
+
+    fwk_module_bind_ExpectAndReturn(
+        config->driver_id,
+        config->driver_api_id,
+        &dev_ctx_table[POWER_METER_TEST_DEV_IDX_SAMPLED].driver_api,
+        FWK_SUCCESS);
+    fwk_module_bind_ExpectAndReturn(
+        config->alarm_id,
+        MOD_TIMER_API_ID_ALARM,
+        &power_meter_ctx.alarm_api,
+        FWK_SUCCESS);
+
+    status =
+        power_meter_bind(TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_SAMPLED), 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_meter_bind_driver_input_only(void)
+{
+    int status;
+
+    /* No driver API nor alarm to bind to */
+    status =
+        power_meter_bind(TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED), 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_meter_get_power_accumulates_energy(void)
+{
+    int status;
+    uint32_t power;
+    uint64_t energy;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_POLLED);
+
+    fake_power = 100;
+    expect_measurement(FWK_MS(1), false, 0);
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(100, power);
+
+    /* 100 over 2.5ms */
+    fake_power = 200;
+    expect_measurement(FWK_US(3500), true, FWK_US(2500));
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(200, power);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(250, energy);
+
+    /* 200 over 1.5ms */
+    expect_measurement(FWK_US(5000), true, FWK_US(1500));
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(550, energy);
+}
+
+void test_power_meter_energy_remainder_carried(void)
+{
+    int status;
+    uint64_t energy;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    expect_measurement(0, false, 0);
+    status = power_meter_report_power(id, 3);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* 4.5 energy units, 0.5 carried over */
+    expect_measurement(FWK_US(1500), true, FWK_US(1500));
+    status = power_meter_report_power(id, 3);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(4, energy);
+
+    /* 1.5 energy units plus the 0.5 carried over */
+    expect_measurement(FWK_US(2000), true, FWK_US(500));
+    status = power_meter_report_power(id, 3);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(6, energy);
+}
+
+void test_power_meter_energy_sub_microsecond_carried(void)
+{
+    int status;
+    uint64_t energy;
+    unsigned int idx;
+    fwk_timestamp_t now = 0;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    expect_measurement(now, false, 0);
+    status = power_meter_report_power(id, 1000);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* 1000 over 200 intervals of 1.5us, none of them a whole microsecond */
+    for (idx = 0; idx < 200; idx++) {
+        now += FWK_NS(1500);
+        expect_measurement(now, true, FWK_NS(1500));
+        status = power_meter_report_power(id, 1000);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(300, energy);
+}
+
+void test_power_meter_energy_no_wrap(void)
+{
+    int status;
+    uint64_t energy;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    expect_measurement(0, false, 0);
+    status = power_meter_report_power(id, UINT32_MAX);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Interval long enough to overflow a 32-bit counter many times */
+    expect_measurement(FWK_S(60), true, FWK_S(60));
+    status = power_meter_report_power(id, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)UINT32_MAX * 60000, energy);
+}
+
+void test_power_meter_get_power_not_reported(void)
+{
+    int status;
+    uint32_t power;
+
+    status = power_meter_get_power(
+        TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED), &power);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+}
+
+void test_power_meter_get_power_reported(void)
+{
+    int status;
+    uint32_t power;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    expect_measurement(0, false, 0);
+    status = power_meter_report_power(id, 42);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(42, power);
+}
+
+void test_power_meter_invalid_id(void)
+{
+    int status;
+    uint64_t energy;
+
+    status = power_meter_get_energy(
+        TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_COUNT), &energy);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = power_meter_report_power(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0), 0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_meter_energy_page_updated(void)
+{
+    int status;
+    uint32_t power;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_POLLED);
+
+    fake_power = 1000;
+    expect_measurement(FWK_MS(1), false, 0);
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    expect_measurement(FWK_MS(3), true, FWK_MS(2));
+    status = power_meter_get_power(id, &power);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(4, test_energy_page.sequence);
+    TEST_ASSERT_EQUAL(1000, test_energy_page.power);
+    TEST_ASSERT_EQUAL_UINT64(2000, test_energy_page.energy);
+    TEST_ASSERT_EQUAL_UINT64(FWK_MS(3), test_energy_page.timestamp);
+}
+
+void test_power_meter_thresholds_invalid(void)
+{
+    int status;
+
+    status = power_meter_set_power_change_notif_thresholds(
+        TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_POLLED), 200, 100);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_power_meter_notify_when_leaving_thresholds(void)
+{
+    int status;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    status = power_meter_set_power_change_notif_thresholds(id, 50, 150);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    expect_measurement(0, false, 0);
+    status = power_meter_report_power(id, 100);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    expect_measurement(FWK_MS(1), true, FWK_MS(1));
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status = power_meter_report_power(id, 200);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Still outside of the thresholds */
+    expect_measurement(FWK_MS(2), true, FWK_MS(1));
+    status = power_meter_report_power(id, 210);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_power_meter_start_sampling(void)
+{
+    int status;
+    uint64_t energy;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_SAMPLED);
+    struct fwk_event event = {
+        .id = mod_power_meter_event_id_sample,
+        .target_id = id,
+    };
+
+    status = power_meter_start(id);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, alarm_start_count);
+    TEST_ASSERT_EQUAL(POWER_METER_TEST_SAMPLE_PERIOD, alarm_milliseconds);
+    TEST_ASSERT_EQUAL(MOD_TIMER_ALARM_TYPE_PERIODIC, alarm_type);
+
+    /* The alarm callback defers the sampling to an event */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    alarm_callback(alarm_param);
+
+    fake_power = 10;
+    expect_measurement(0, false, 0);
+    status = power_meter_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    expect_measurement(
+        FWK_MS(POWER_METER_TEST_SAMPLE_PERIOD),
+        true,
+        FWK_MS(POWER_METER_TEST_SAMPLE_PERIOD));
+    status = power_meter_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_meter_get_energy(id, &energy);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(10 * POWER_METER_TEST_SAMPLE_PERIOD, energy);
+}
+
+void test_power_meter_start_without_sampling(void)
+{
+    int status;
+
+    status = power_meter_start(TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_POLLED));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, alarm_start_count);
+}
+
+void test_power_meter_energy_sensor(void)
+{
+    int status;
+    const void *api;
+    const struct mod_sensor_driver_api *sensor_api;
+    struct mod_sensor_info info;
+    mod_sensor_value_t value;
+    fwk_id_t id = TEST_DEV_ID(POWER_METER_TEST_DEV_IDX_REPORTED);
+
+    status = power_meter_process_bind_request(
+        FWK_ID_MODULE(FWK_MODULE_IDX_POWER_METER),
+        id,
+        FWK_ID_API(
+            FWK_MODULE_IDX_POWER_METER, MOD_POWER_METER_API_IDX_ENERGY_SENSOR),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    sensor_api = api;
+
+    status = sensor_api->get_info(id, &info);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(MOD_SENSOR_TYPE_JOULES, info.type);
+    TEST_ASSERT_EQUAL(-6, info.unit_multiplier);
+    TEST_ASSERT_FALSE(info.disabled);
+
+    dev_ctx_table[POWER_METER_TEST_DEV_IDX_REPORTED].energy = 1234;
+    status = sensor_api->get_value(id, &value);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(1234, value);
+}
+
+void test_power_meter_bind_request_invalid_api(void)
+{
+    int status;
+    const void *api;
+
+    status = power_meter_process_bind_request(
+        FWK_ID_MODULE(FWK_MODULE_IDX_POWER_METER),
+        TEST_DEV_ID(0),
+        FWK_ID_API(FWK_MODULE_IDX_POWER_METER, MOD_POWER_METER_API_IDX_COUNT),
+        &api);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+}
+
+int power_meter_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_power_meter_init_invalid_element_count);
+    RUN_TEST(test_power_meter_element_init_sampling_without_driver);
+    RUN_TEST(test_power_meter_bind_driver_and_alarm);
+    RUN_TEST(test_power_meter_bind_driver_input_only);
+    RUN_TEST(test_power_meter_get_power_accumulates_energy);
+    RUN_TEST(test_power_meter_energy_remainder_carried);
+    RUN_TEST(test_power_meter_energy_sub_microsecond_carried);
+    RUN_TEST(test_power_meter_energy_no_wrap);
+    RUN_TEST(test_power_meter_get_power_not_reported);
+    RUN_TEST(test_power_meter_get_power_reported);
+    RUN_TEST(test_power_meter_invalid_id);
+    RUN_TEST(test_power_meter_energy_page_updated);
+    RUN_TEST(test_power_meter_thresholds_invalid);
+    RUN_TEST(test_power_meter_notify_when_leaving_thresholds);
+    RUN_TEST(test_power_meter_start_sampling);
+    RUN_TEST(test_power_meter_start_without_sampling);
+    RUN_TEST(test_power_meter_energy_sensor);
+    RUN_TEST(test_power_meter_bind_request_invalid_api);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_meter_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,7 +13,10 @@
 
 #include <mod_power_domain.h>
 
+#include <fwk_id.h>
+
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -26,6 +29,18 @@
  * \{
  */
 
+/*!
+ * \brief Indexes of the interfaces exposed by the module.
+ */
+enum mod_ppu_v0_api_idx {
+    /*! Power domain driver API */
+    MOD_PPU_V0_API_IDX_POWER_DOMAIN_DRIVER,
+    /*! Batch API */
+    MOD_PPU_V0_API_IDX_BATCH,
+    /*! Number of exposed interfaces */
+    MOD_PPU_V0_API_IDX_COUNT,
+};
+
 /*!
  * \brief Power domain PPU descriptor.
  */
@@ -77,6 +92,44 @@ struct mod_ppu_v0_pd_config {
      * Timeout is not provided at this stage.
      */
     bool default_power_on;
+
+    /*!
+     * \brief Complete the transitions through the PPU interrupt.
+     *
+     * \details When \c true, \c set_state only requests the power policy and
+     *      returns. The PPU interrupt then reports the transition to the entity
+     *      bound to the power domain, once the PPU has reached the new state
+     *      or with the current state if the transition is denied. The PPU
+     *      interrupt ::mod_ppu_v0::irq must be wired to the SCP.
+     */
+    bool irq_completion;
+};
+
+/*!
+ * \brief PPU_V0 batch API.
+ *
+ * \details Sets a group of PPUs to the same power state, e.g. the system PPUs
+ *      during a system transition. All the power policies are requested
+ *      before waiting, so that the PPUs transition in parallel and the wait is
+ *      that of the slowest PPU rather than the sum of all of them.
+ *
+ *      The transitions are not reported to the entities bound to the power
+ *      domains, the caller is expected to own the power domains.
+ */
+struct mod_ppu_v0_batch_api {
+    /*!
+     * \brief Set the power state of a group of power domains.
+     *
+     * \param pd_ids Identifiers of the power domains.
+     * \param count Number of power domains.
+     * \param state Power state, ::MOD_PD_STATE_ON or ::MOD_PD_STATE_OFF.
+     *
+     * \retval ::FWK_SUCCESS All the power domains reached the power state.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_TIMEOUT A power domain did not reach the power state in
+     *      time.
+     */
+    int (*set_state)(const fwk_id_t *pd_ids, size_t count, unsigned int state);
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -19,6 +19,7 @@
 
 #include <fwk_assert.h>
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
 #include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
@@ -26,9 +27,13 @@
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/* Interrupts completing a transition requested through the power policy */
+#define PPU_V0_TRANSITION_IRQS (PPU_V0_ISR_STA_POLICY_TRN | PPU_V0_ISR_STA_DENY)
+
 /* Power domain context */
 struct ppu_v0_pd_ctx {
     /* Power domain configuration data */
@@ -96,6 +101,24 @@ static int get_state(struct ppu_v0_reg *ppu, unsigned int *state)
     return FWK_SUCCESS;
 }
 
+static int state_to_ppu_mode(unsigned int state, enum ppu_v0_mode *mode)
+{
+    switch (state) {
+    case MOD_PD_STATE_ON:
+        *mode = PPU_V0_MODE_ON;
+        return FWK_SUCCESS;
+
+    case MOD_PD_STATE_OFF:
+        *mode = PPU_V0_MODE_OFF;
+        return FWK_SUCCESS;
+
+    default:
+        FWK_LOG_ERR(
+            "[PPU] Requested power state (%i) is not supported.", state);
+        return FWK_E_PARAM;
+    }
+}
+
 static int pd_init(struct ppu_v0_pd_ctx *pd_ctx)
 {
     ppu_v0_init(pd_ctx->ppu);
@@ -103,6 +126,31 @@ static int pd_init(struct ppu_v0_pd_ctx *pd_ctx)
     return FWK_SUCCESS;
 }
 
+/*
+ * Request the transition without waiting for it, the PPU interrupt reports its
+ * completion.
+ */
+static int pd_set_state_async(struct ppu_v0_pd_ctx *pd_ctx, unsigned int state)
+{
+    int status;
+    enum ppu_v0_mode mode;
+
+    status = state_to_ppu_mode(state, &mode);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    /* No transition, hence no interrupt, when the PPU is already there */
+    if (ppu_v0_is_power_mode(pd_ctx->ppu, mode)) {
+        return pd_ctx->pd_driver_input_api->report_power_state_transition(
+            pd_ctx->bound_id, state);
+    }
+
+    ppu_v0_ack_interrupt(pd_ctx->ppu, PPU_V0_TRANSITION_IRQS);
+    ppu_v0_interrupt_unmask(pd_ctx->ppu, PPU_V0_TRANSITION_IRQS);
+
+    return ppu_v0_request_power_mode(pd_ctx->ppu, mode);
+}
+
 static int pd_set_state(fwk_id_t pd_id, unsigned int state)
 {
     int status;
@@ -113,6 +161,9 @@ static int pd_set_state(fwk_id_t pd_id, unsigned int state)
 
     fwk_assert(pd_ctx->pd_driver_input_api != NULL);
 
+    if (pd_ctx->config->irq_completion)
+        return pd_set_state_async(pd_ctx, state);
+
     switch (state) {
     case MOD_PD_STATE_ON:
         status = ppu_v0_set_power_mode(
@@ -183,6 +234,86 @@ static const struct mod_pd_driver_api pd_driver = {
     .reset = pd_reset,
 };
 
+static void ppu_v0_interrupt_handler(uintptr_t pd_ctx_param)
+{
+    int status;
+    uint32_t pending;
+    unsigned int state;
+    struct ppu_v0_pd_ctx *pd_ctx = (struct ppu_v0_pd_ctx *)pd_ctx_param;
+
+    fwk_assert(pd_ctx != NULL);
+
+    pending = ppu_v0_get_pending_interrupts(pd_ctx->ppu) &
+        PPU_V0_TRANSITION_IRQS;
+    if (pending == 0)
+        return;
+
+    ppu_v0_ack_interrupt(pd_ctx->ppu, pending);
+    ppu_v0_interrupt_mask(pd_ctx->ppu, PPU_V0_TRANSITION_IRQS);
+
+    /* A denied transition leaves the PPU in its current state */
+    status = get_state(pd_ctx->ppu, &state);
+    if (status != FWK_SUCCESS)
+        return;
+
+    status = pd_ctx->pd_driver_input_api->report_power_state_transition(
+        pd_ctx->bound_id, state);
+    fwk_assert(status == FWK_SUCCESS);
+    (void)status;
+}
+
+/*
+ * Batch interface
+ */
+
+static int ppu_v0_batch_set_state(const fwk_id_t *pd_ids, size_t count,
+                                  unsigned int state)
+{
+    int status;
+    size_t idx;
+    bool done;
+    enum ppu_v0_mode mode;
+    unsigned int wait_cycles;
+    struct ppu_v0_pd_ctx *pd_ctx;
+
+    if ((pd_ids == NULL) && (count != 0))
+        return FWK_E_PARAM;
+
+    status = state_to_ppu_mode(state, &mode);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    for (idx = 0; idx < count; idx++) {
+        if ((fwk_id_get_module_idx(pd_ids[idx]) != FWK_MODULE_IDX_PPU_V0) ||
+            !fwk_module_is_valid_element_id(pd_ids[idx]))
+            return FWK_E_PARAM;
+    }
+
+    /* Request all the transitions first so that they happen in parallel */
+    for (idx = 0; idx < count; idx++) {
+        pd_ctx = ppu_v0_ctx.pd_ctx_table + fwk_id_get_element_idx(pd_ids[idx]);
+        ppu_v0_request_power_mode(pd_ctx->ppu, mode);
+    }
+
+    for (wait_cycles = PPU_V0_WAIT_TIMEOUT; wait_cycles > 0; wait_cycles--) {
+        done = true;
+        for (idx = 0; (idx < count) && done; idx++) {
+            pd_ctx =
+                ppu_v0_ctx.pd_ctx_table + fwk_id_get_element_idx(pd_ids[idx]);
+            done = ppu_v0_is_power_mode(pd_ctx->ppu, mode);
+        }
+
+        if (done)
+            return FWK_SUCCESS;
+    }
+
+    return FWK_E_TIMEOUT;
+}
+
+static const struct mod_ppu_v0_batch_api batch_api = {
+    .set_state = ppu_v0_batch_set_state,
+};
+
 /*
  * Framework handlers
  */
@@ -228,6 +359,15 @@ static int ppu_v0_pd_init(fwk_id_t pd_id, unsigned int unused, const void *data)
 #else
     pd_ctx->timer_ctx = NULL;
 #endif
+
+    if (config->irq_completion) {
+        status = fwk_interrupt_set_isr_param(config->ppu.irq,
+                                             ppu_v0_interrupt_handler,
+                                             (uintptr_t)pd_ctx);
+        if (status != FWK_SUCCESS)
+            return status;
+    }
+
     switch (config->pd_type) {
     case MOD_PD_TYPE_DEVICE:
     case MOD_PD_TYPE_DEVICE_DEBUG:
@@ -298,12 +438,34 @@ static int ppu_v0_bind(fwk_id_t id, unsigned int round)
     return status;
 }
 
+static int ppu_v0_start(fwk_id_t id)
+{
+    struct ppu_v0_pd_ctx *pd_ctx;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
+        return FWK_SUCCESS;
+
+    pd_ctx = ppu_v0_ctx.pd_ctx_table + fwk_id_get_element_idx(id);
+
+    if (!pd_ctx->config->irq_completion)
+        return FWK_SUCCESS;
+
+    /* The transition interrupts are only unmasked while one is ongoing */
+    fwk_interrupt_clear_pending(pd_ctx->config->ppu.irq);
+    return fwk_interrupt_enable(pd_ctx->config->ppu.irq);
+}
+
 static int ppu_v0_process_bind_request(fwk_id_t source_id,
-                                       fwk_id_t target_id, fwk_id_t not_used,
+                                       fwk_id_t target_id, fwk_id_t api_id,
                                        const void **api)
 {
     struct ppu_v0_pd_ctx *pd_ctx;
 
+    if (fwk_id_get_api_idx(api_id) == MOD_PPU_V0_API_IDX_BATCH) {
+        *api = &batch_api;
+        return FWK_SUCCESS;
+    }
+
     pd_ctx = ppu_v0_ctx.pd_ctx_table + fwk_id_get_element_idx(target_id);
 
     switch (pd_ctx->config->pd_type) {
@@ -343,9 +505,10 @@ static int ppu_v0_process_bind_request(fwk_id_t source_id,
 
 const struct fwk_module module_ppu_v0 = {
     .type = FWK_MODULE_TYPE_DRIVER,
-    .api_count = 1,
+    .api_count = MOD_PPU_V0_API_IDX_COUNT,
     .init = ppu_v0_mod_init,
     .element_init = ppu_v0_pd_init,
     .bind = ppu_v0_bind,
+    .start = ppu_v0_start,
     .process_bind_request = ppu_v0_process_bind_request,
 };
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -64,14 +64,17 @@ int ppu_v0_set_power_mode(
     int status;
     fwk_assert(ppu != NULL);
     struct set_power_status_check_params_v0 params;
+    unsigned int wait_cycles;
 
     status = ppu_v0_request_power_mode(ppu, mode);
     if (status != FWK_SUCCESS)
         return status;
     if (timer_ctx == NULL) {
-        while ((ppu->POWER_STATUS &
-                (PPU_V0_PSR_POWSTAT | PPU_V0_PSR_DYNAMIC)) != mode)
-            continue;
+        wait_cycles = PPU_V0_WAIT_TIMEOUT;
+        while (!ppu_v0_is_power_mode(ppu, mode)) {
+            if (wait_cycles-- == 0)
+                return FWK_E_TIMEOUT;
+        }
     } else {
         params.mode = mode;
         params.reg = ppu;
@@ -94,3 +97,39 @@ int ppu_v0_get_power_mode(struct ppu_v0_reg *ppu, enum ppu_v0_mode *mode)
 
     return FWK_SUCCESS;
 }
+
+bool ppu_v0_is_power_mode(struct ppu_v0_reg *ppu, enum ppu_v0_mode mode)
+{
+    fwk_assert(ppu != NULL);
+
+    return (ppu->POWER_STATUS & (PPU_V0_PSR_POWSTAT | PPU_V0_PSR_DYNAMIC)) ==
+        mode;
+}
+
+void ppu_v0_interrupt_mask(struct ppu_v0_reg *ppu, uint32_t mask)
+{
+    fwk_assert(ppu != NULL);
+
+    ppu->IMR |= mask & PPU_V0_IMR_MASK;
+}
+
+void ppu_v0_interrupt_unmask(struct ppu_v0_reg *ppu, uint32_t mask)
+{
+    fwk_assert(ppu != NULL);
+
+    ppu->IMR &= ~(mask & PPU_V0_IMR_MASK);
+}
+
+uint32_t ppu_v0_get_pending_interrupts(struct ppu_v0_reg *ppu)
+{
+    fwk_assert(ppu != NULL);
+
+    return ppu->ISR & ~ppu->IMR & PPU_V0_ISR_MASK;
+}
+
+void ppu_v0_ack_interrupt(struct ppu_v0_reg *ppu, uint32_t mask)
+{
+    fwk_assert(ppu != NULL);
+
+    ppu->ISR = mask & PPU_V0_ISR_MASK;
+}
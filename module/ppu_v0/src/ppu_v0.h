@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -130,6 +130,12 @@ enum ppu_v0_mode {
  */
 #define PPU_V0_ARCHITECTURE_ID UINT32_C(0x00000000)
 
+/*
+ * Maximum number of status reads when waiting for a PPU without a timer
+ * context.
+ */
+#define PPU_V0_WAIT_TIMEOUT UINT32_C(0x100000)
+
 /*
  * Timer context to be passed to set_power_mode function.
  */
@@ -149,6 +155,11 @@ int ppu_v0_set_power_mode(
     enum ppu_v0_mode mode,
     struct ppu_v0_timer_ctx *timer_ctx);
 int ppu_v0_get_power_mode(struct ppu_v0_reg *ppu, enum ppu_v0_mode *mode);
+bool ppu_v0_is_power_mode(struct ppu_v0_reg *ppu, enum ppu_v0_mode mode);
+void ppu_v0_interrupt_mask(struct ppu_v0_reg *ppu, uint32_t mask);
+void ppu_v0_interrupt_unmask(struct ppu_v0_reg *ppu, uint32_t mask);
+uint32_t ppu_v0_get_pending_interrupts(struct ppu_v0_reg *ppu);
+void ppu_v0_ack_interrupt(struct ppu_v0_reg *ppu, uint32_t mask);
 
 /*!
  * \endcond
@@ -72,6 +72,27 @@ enum ppu_v1_opmode {
     PPU_V1_OPMODE_COUNT
 };
 
+/*!
+ * \brief Retention mode a running core enters and leaves on its own.
+ *
+ * \details The core PPU is left in dynamic mode with the retention mode as
+ *      its minimum policy. The hardware moves the core in and out of
+ *      retention following the core requests, without the firmware being
+ *      involved. From the power domain point of view, the core stays ON.
+ */
+enum mod_ppu_v1_core_retention {
+    /*! No retention, the core turns off when idle and reports SLEEP */
+    MOD_PPU_V1_CORE_RETENTION_NONE,
+    /*! Memory retention */
+    MOD_PPU_V1_CORE_RETENTION_MEM_RET,
+    /*! Full retention */
+    MOD_PPU_V1_CORE_RETENTION_FULL_RET,
+    /*! Functional retention */
+    MOD_PPU_V1_CORE_RETENTION_FUNC_RET,
+    /*! Number of retention modes */
+    MOD_PPU_V1_CORE_RETENTION_COUNT,
+};
+
 /*!
  * \brief Power domain PPU descriptor.
  */
@@ -81,6 +102,13 @@ struct mod_ppu_v1 {
 
     /*! PPU's IRQ number */
     unsigned int irq;
+
+    /*!
+     * \brief PPU's IRQ priority.
+     *
+     * \details Zero leaves the interrupt at its reset priority.
+     */
+    unsigned int irq_priority;
 };
 /*!
  * \brief Timer for set_state.
@@ -93,7 +121,9 @@ struct mod_ppu_v1_timer_config {
      * \brief Timer identifier.
      *
      * \details Used for binding with the timer API and waiting for specified
-     *          delay after setting the PPU state.
+     *          delay after setting the PPU state. For a cluster, the delay
+     *          also bounds the wait for its cores to lock before it is turned
+     *          off.
      */
     fwk_id_t timer_id;
 
@@ -190,6 +220,14 @@ struct mod_ppu_v1_pd_config {
      * value greater than 0 if using the alarm.
      */
     uint32_t alarm_delay;
+
+    /*!
+     * \brief Retention mode of a core power domain.
+     *
+     * \details Only applies to core power domains. Defaults to
+     *      ::MOD_PPU_V1_CORE_RETENTION_NONE.
+     */
+    enum mod_ppu_v1_core_retention core_retention;
 };
 
 /*!
@@ -110,6 +110,13 @@ static const uint8_t ppu_mode_to_power_state[] = {
     [PPU_V1_MODE_DBG_RECOV]   = (uint8_t)MODE_UNSUPPORTED
 };
 
+static const enum ppu_v1_mode core_retention_to_ppu_mode[] = {
+    [MOD_PPU_V1_CORE_RETENTION_NONE] = PPU_V1_MODE_OFF,
+    [MOD_PPU_V1_CORE_RETENTION_MEM_RET] = PPU_V1_MODE_MEM_RET,
+    [MOD_PPU_V1_CORE_RETENTION_FULL_RET] = PPU_V1_MODE_FULL_RET,
+    [MOD_PPU_V1_CORE_RETENTION_FUNC_RET] = PPU_V1_MODE_FUNC_RET,
+};
+
 /*
  * Functions not specific to any type of power domain
  */
@@ -220,6 +227,22 @@ static int ppu_v1_pd_set_state(fwk_id_t pd_id, unsigned int state)
     return status;
 }
 
+/*
+ * Enable the dynamic transitions of a PPU down to the given mode. The PPU is
+ * left untouched when it already runs in dynamic mode with that minimum
+ * policy, saving the policy write and the wait for the dynamic status.
+ */
+static void dynamic_enable(struct ppu_v1_reg *ppu,
+                           enum ppu_v1_mode min_dyn_mode)
+{
+    if (ppu_v1_is_dynamic_enabled(ppu) &&
+        (ppu_v1_get_programmed_power_mode(ppu) == min_dyn_mode)) {
+        return;
+    }
+
+    ppu_v1_dynamic_enable(ppu, min_dyn_mode);
+}
+
 static int ppu_v1_pd_get_state(fwk_id_t pd_id, unsigned int *state)
 {
     struct ppu_v1_pd_ctx *pd_ctx;
@@ -263,6 +286,27 @@ static const struct mod_pd_driver_api pd_driver = {
 /*
  * Functions specific to core power domains
  */
+
+/*
+ * Let a running core transition on its own. A core with a retention mode
+ * enters and leaves it in hardware with the minimum policy interrupt masked,
+ * the firmware is not involved. Other cores may turn off, which the minimum
+ * policy interrupt reports as SLEEP.
+ */
+static void core_dynamic_enable(struct ppu_v1_pd_ctx *pd_ctx)
+{
+    enum mod_ppu_v1_core_retention retention = pd_ctx->config->core_retention;
+
+    if (retention == MOD_PPU_V1_CORE_RETENTION_NONE) {
+        ppu_v1_interrupt_unmask(
+            pd_ctx->ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+    } else {
+        ppu_v1_interrupt_mask(pd_ctx->ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+    }
+
+    dynamic_enable(pd_ctx->ppu, core_retention_to_ppu_mode[retention]);
+}
+
 static int ppu_v1_core_pd_init(struct ppu_v1_pd_ctx *pd_ctx)
 {
     int status;
@@ -277,14 +321,32 @@ static int ppu_v1_core_pd_init(struct ppu_v1_pd_ctx *pd_ctx)
     }
 
     if (state == MOD_PD_STATE_ON) {
-        ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
-        ppu_v1_dynamic_enable(ppu, PPU_V1_MODE_OFF);
+        core_dynamic_enable(pd_ctx);
     }
 
     return FWK_SUCCESS;
 }
 
 #ifdef BUILD_HAS_MOD_POWER_DOMAIN
+static int ppu_v1_core_pd_get_state(fwk_id_t core_pd_id, unsigned int *state)
+{
+    struct ppu_v1_pd_ctx *pd_ctx;
+    enum mod_ppu_v1_core_retention retention;
+
+    pd_ctx = ppu_v1_ctx.pd_ctx_table + fwk_id_get_element_idx(core_pd_id);
+    retention = pd_ctx->config->core_retention;
+
+    /* A core in its retention mode is still ON for the power domain */
+    if ((retention != MOD_PPU_V1_CORE_RETENTION_NONE) &&
+        (ppu_v1_get_power_mode(pd_ctx->ppu) ==
+         core_retention_to_ppu_mode[retention])) {
+        *state = MOD_PD_STATE_ON;
+        return FWK_SUCCESS;
+    }
+
+    return get_state(pd_ctx->ppu, state);
+}
+
 static int ppu_v1_core_pd_set_state(fwk_id_t core_pd_id, unsigned int state)
 {
     int status;
@@ -309,13 +371,11 @@ static int ppu_v1_core_pd_set_state(fwk_id_t core_pd_id, unsigned int state)
         break;
 
     case MOD_PD_STATE_ON:
-        ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
-
         ppu_v1_set_input_edge_sensitivity(
             ppu, PPU_V1_MODE_ON, PPU_V1_EDGE_SENSITIVITY_MASKED);
 
         ppu_v1_set_power_mode(ppu, PPU_V1_MODE_ON, pd_ctx->timer_ctx);
-        ppu_v1_dynamic_enable(ppu, PPU_V1_MODE_OFF);
+        core_dynamic_enable(pd_ctx);
         status = pd_ctx->pd_driver_input_api->report_power_state_transition(
             pd_ctx->bound_id, MOD_PD_STATE_ON);
         fwk_assert(status == FWK_SUCCESS);
@@ -329,7 +389,7 @@ static int ppu_v1_core_pd_set_state(fwk_id_t core_pd_id, unsigned int state)
          * the dynamic mode must be enabled
          * the lock feature must be enabled
          */
-        ppu_v1_dynamic_enable(ppu, PPU_V1_MODE_OFF);
+        dynamic_enable(ppu, PPU_V1_MODE_OFF);
         ppu_v1_lock_off_enable(ppu);
 
         ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
@@ -391,7 +451,9 @@ static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
         ppu_v1_set_input_edge_sensitivity(ppu,
                                           PPU_V1_MODE_ON,
                                           PPU_V1_EDGE_SENSITIVITY_MASKED);
-        ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+
+        /* Back from SLEEP, restore the retention mode of the core */
+        core_dynamic_enable(pd_ctx);
 
         status = pd_ctx->pd_driver_input_api->report_power_state_transition(
             pd_ctx->bound_id, MOD_PD_STATE_ON);
@@ -441,7 +503,7 @@ static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
 #ifdef BUILD_HAS_MOD_POWER_DOMAIN
 static const struct mod_pd_driver_api core_pd_driver = {
     .set_state = ppu_v1_core_pd_set_state,
-    .get_state = ppu_v1_pd_get_state,
+    .get_state = ppu_v1_core_pd_get_state,
     .reset = ppu_v1_core_pd_reset,
     .prepare_core_for_system_suspend =
         ppu_v1_core_pd_prepare_for_system_suspend,
@@ -470,39 +532,101 @@ static void unlock_all_cores(struct ppu_v1_pd_ctx *pd_ctx)
     }
 }
 
+/*
+ * Data of the wait for the dynamic cores of a cluster to lock. The wait ends
+ * when all of them are locked or when one of them is requested on.
+ */
+struct lock_dynamic_cores_wait_data {
+    struct ppu_v1_cluster_pd_ctx *cluster_pd_ctx;
+    bool core_on_requested;
+};
+
+static bool dynamic_cores_lock_check(void *data)
+{
+    struct lock_dynamic_cores_wait_data *wait_data = data;
+    struct ppu_v1_cluster_pd_ctx *cluster_pd_ctx = wait_data->cluster_pd_ctx;
+    struct ppu_v1_reg *cpu_ppu;
+    unsigned int core_idx;
+    bool all_locked = true;
+
+    for (core_idx = 0; core_idx < cluster_pd_ctx->core_count; ++core_idx) {
+        cpu_ppu = cluster_pd_ctx->core_pd_ctx_table[core_idx]->ppu;
+
+        if (!ppu_v1_is_dynamic_enabled(cpu_ppu)) {
+            continue;
+        }
+
+        if (ppu_v1_is_power_devactive_high(cpu_ppu, PPU_V1_MODE_ON)) {
+            wait_data->core_on_requested = true;
+            return true;
+        }
+
+        if (!ppu_v1_is_locked(cpu_ppu)) {
+            all_locked = false;
+        }
+    }
+
+    return all_locked;
+}
+
 static bool lock_all_dynamic_cores(struct ppu_v1_pd_ctx *pd_ctx)
 {
+    int status;
     struct ppu_v1_cluster_pd_ctx *cluster_pd_ctx;
     struct ppu_v1_reg *cpu_ppu;
+    struct lock_dynamic_cores_wait_data wait_data;
     unsigned int core_idx;
+    unsigned int wait_cycles;
 
     fwk_assert(pd_ctx != NULL);
 
     cluster_pd_ctx = pd_ctx->data;
 
+    /*
+     * Request the lock of all the cores before waiting for any of them, so
+     * that they lock in parallel.
+     */
     for (core_idx = 0; core_idx < cluster_pd_ctx->core_count; ++core_idx) {
         cpu_ppu = cluster_pd_ctx->core_pd_ctx_table[core_idx]->ppu;
 
-        if (!ppu_v1_is_dynamic_enabled(cpu_ppu)) {
-            continue;
+        if (ppu_v1_is_dynamic_enabled(cpu_ppu)) {
+            ppu_v1_lock_off_enable(cpu_ppu);
         }
+    }
 
-        ppu_v1_lock_off_enable(cpu_ppu);
-        while ((!ppu_v1_is_locked(cpu_ppu)) &&
-               (!ppu_v1_is_power_devactive_high(cpu_ppu, PPU_V1_MODE_ON))) {
-            continue;
-        }
+    wait_data = (struct lock_dynamic_cores_wait_data){
+        .cluster_pd_ctx = cluster_pd_ctx,
+        .core_on_requested = false,
+    };
 
-        if (ppu_v1_is_power_devactive_high(cpu_ppu, PPU_V1_MODE_ON)) {
-            return false;
+    if (pd_ctx->timer_ctx != NULL) {
+        status = pd_ctx->timer_ctx->timer_api->wait(
+            pd_ctx->timer_ctx->timer_id,
+            pd_ctx->timer_ctx->delay_us,
+            dynamic_cores_lock_check,
+            &wait_data);
+    } else {
+        status = FWK_E_TIMEOUT;
+        for (wait_cycles = PPU_V1_WAIT_TIMEOUT; wait_cycles > 0;
+             --wait_cycles) {
+            if (dynamic_cores_lock_check(&wait_data)) {
+                status = FWK_SUCCESS;
+                break;
+            }
         }
     }
 
-    return true;
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR("[PPU_V1] Timeout locking the cores of a cluster");
+        return false;
+    }
+
+    return !wait_data.core_on_requested;
 }
 
 static bool cluster_off(struct ppu_v1_pd_ctx *pd_ctx)
 {
+    int status;
     struct ppu_v1_reg *ppu;
     bool lock_successful;
 
@@ -520,7 +644,12 @@ static bool cluster_off(struct ppu_v1_pd_ctx *pd_ctx)
         return false;
     }
 
-    ppu_v1_set_power_mode(ppu, PPU_V1_MODE_OFF, pd_ctx->timer_ctx);
+    status = ppu_v1_set_power_mode(ppu, PPU_V1_MODE_OFF, pd_ctx->timer_ctx);
+    if (status != FWK_SUCCESS) {
+        unlock_all_cores(pd_ctx);
+        return false;
+    }
+
     return true;
 }
 
@@ -799,11 +928,17 @@ static int ppu_v1_pd_init(fwk_id_t pd_id, unsigned int unused, const void *data)
     struct ppu_v1_pd_ctx *pd_ctx;
     struct ppu_v1_pd_ctx **core_pd_ctx_table;
     struct ppu_v1_cluster_pd_ctx *cluster_pd_ctx;
+    int status;
 
     if (config->pd_type >= MOD_PD_TYPE_COUNT) {
         return FWK_E_DATA;
     }
 
+    if ((config->pd_type == MOD_PD_TYPE_CORE) &&
+        (config->core_retention >= MOD_PPU_V1_CORE_RETENTION_COUNT)) {
+        return FWK_E_DATA;
+    }
+
     pd_ctx = ppu_v1_ctx.pd_ctx_table + fwk_id_get_element_idx(pd_id);
     pd_ctx->config = config;
     pd_ctx->ppu = (struct ppu_v1_reg *)(config->ppu.reg_base);
@@ -813,6 +948,14 @@ static int ppu_v1_pd_init(fwk_id_t pd_id, unsigned int unused, const void *data)
         fwk_interrupt_set_isr_param(config->ppu.irq,
                                     ppu_interrupt_handler,
                                     (uintptr_t)pd_ctx);
+
+        if (config->ppu.irq_priority != 0) {
+            status = fwk_interrupt_set_priority(
+                config->ppu.irq, config->ppu.irq_priority);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
     }
 
     if (config->pd_type == MOD_PD_TYPE_CLUSTER) {
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,20 @@
 
 #include <stddef.h>
 
+/* Wait until the masked PWSR register reads the given value */
+static int ppu_v1_wait_pwsr(struct ppu_v1_reg *ppu, uint32_t mask,
+                            uint32_t value)
+{
+    unsigned int wait_cycles = PPU_V1_WAIT_TIMEOUT;
+
+    while ((ppu->PWSR & mask) != value) {
+        if (wait_cycles-- == 0)
+            return FWK_E_TIMEOUT;
+    }
+
+    return FWK_SUCCESS;
+}
+
 struct set_power_status_check_params_v1 {
     enum ppu_v1_mode mode;
     struct ppu_v1_reg *reg;
@@ -71,21 +85,17 @@ int ppu_v1_set_power_mode(
         return status;
 
     if (timer_ctx == NULL) {
-        while ((ppu->PWSR &
-                (PPU_V1_PWSR_PWR_STATUS | PPU_V1_PWSR_PWR_DYN_STATUS)) !=
-               ppu_mode)
-            continue;
-    } else {
-        params.mode = ppu_mode;
-        params.reg = ppu;
-        return timer_ctx->timer_api->wait(
-            timer_ctx->timer_id,
-            timer_ctx->delay_us,
-            ppu_v1_set_power_status_check,
-            &params);
+        return ppu_v1_wait_pwsr(ppu,
+            PPU_V1_PWSR_PWR_STATUS | PPU_V1_PWSR_PWR_DYN_STATUS, ppu_mode);
     }
 
-    return FWK_SUCCESS;
+    params.mode = ppu_mode;
+    params.reg = ppu;
+    return timer_ctx->timer_api->wait(
+        timer_ctx->timer_id,
+        timer_ctx->delay_us,
+        ppu_v1_set_power_status_check,
+        &params);
 }
 
 int ppu_v1_request_operating_mode(struct ppu_v1_reg *ppu,
@@ -113,8 +123,8 @@ void ppu_v1_opmode_dynamic_enable(struct ppu_v1_reg *ppu,
     ppu->PWPR = power_policy |
                 PPU_V1_PWPR_OP_DYN_EN |
                 (min_dyn_mode << PPU_V1_PWPR_OP_POLICY_POS);
-    while ((ppu->PWSR & PPU_V1_PWSR_OP_DYN_STATUS) == 0)
-        continue;
+    (void)ppu_v1_wait_pwsr(ppu, PPU_V1_PWSR_OP_DYN_STATUS,
+                           PPU_V1_PWSR_OP_DYN_STATUS);
 }
 
 void ppu_v1_dynamic_enable(struct ppu_v1_reg *ppu,
@@ -127,8 +137,8 @@ void ppu_v1_dynamic_enable(struct ppu_v1_reg *ppu,
 
     power_policy = ppu->PWPR & ~PPU_V1_PWPR_POLICY;
     ppu->PWPR = power_policy | PPU_V1_PWPR_DYNAMIC_EN | min_dyn_state;
-    while ((ppu->PWSR & PPU_V1_PWSR_PWR_DYN_STATUS) == 0)
-        continue;
+    (void)ppu_v1_wait_pwsr(ppu, PPU_V1_PWSR_PWR_DYN_STATUS,
+                           PPU_V1_PWSR_PWR_DYN_STATUS);
 }
 
 void ppu_v1_lock_off_enable(struct ppu_v1_reg *ppu)
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -230,6 +230,12 @@ enum ppu_v1_edge_sensitivity {
 #define PPU_V1_IDR0_NUM_OPMODE_POS    4
 #define PPU_V1_IDR0_NUM_OPMODE        UINT32_C(0x000000F0)
 
+/*
+ * Maximum number of status reads when waiting for a PPU without a timer
+ * context.
+ */
+#define PPU_V1_WAIT_TIMEOUT UINT32_C(0x100000)
+
 /*
  * Timer context to be passed to set_power_mode function.
  */
@@ -268,13 +274,17 @@ int ppu_v1_request_operating_mode(struct ppu_v1_reg *ppu,
                                   enum ppu_v1_opmode op_mode);
 
 /*
- * Enable PPU's dynamic operating mode transitions
+ * Enable PPU's dynamic operating mode transitions.
+ * Note: The wait for the dynamic mode to be enabled is bounded, the caller can
+ *       read the operating mode status to tell whether it took effect.
  */
 void ppu_v1_opmode_dynamic_enable(struct ppu_v1_reg *ppu,
                                   enum ppu_v1_opmode min_dyn_mode);
 
 /*
- * Enable PPU's dynamic power mode transitions
+ * Enable PPU's dynamic power mode transitions.
+ * Note: The wait for the dynamic mode to be enabled is bounded,
+ *       ppu_v1_is_dynamic_enabled() tells whether it took effect.
  */
 void ppu_v1_dynamic_enable(struct ppu_v1_reg *ppu,
                            enum ppu_v1_mode min_dyn_state);
@@ -33,6 +33,47 @@ static struct mod_timer_alarm_api alarm_api_driver = {
     .stop = stop_alarm_api,
 };
 
+static struct ppu_v1_reg core_ppu_table[CORES_PER_CLUSTER];
+static struct ppu_v1_pd_ctx core_pd_ctx[CORES_PER_CLUSTER];
+static struct ppu_v1_pd_ctx *core_pd_ctx_table[CORES_PER_CLUSTER];
+static struct ppu_v1_cluster_pd_ctx cluster_pd_ctx_ut;
+
+static int timer_wait(
+    fwk_id_t dev_id,
+    uint32_t microseconds,
+    bool (*cond)(void *),
+    void *data)
+{
+    return cond(data) ? FWK_SUCCESS : FWK_E_TIMEOUT;
+}
+
+static struct mod_timer_api timer_api_driver = {
+    .wait = timer_wait,
+};
+
+static struct ppu_v1_timer_ctx cluster_timer_ctx = {
+    .timer_api = &timer_api_driver,
+    .delay_us = 10,
+};
+
+static struct ppu_v1_pd_ctx *set_up_cluster(void)
+{
+    struct ppu_v1_pd_ctx *cluster_pd_ctx = &ppu_v1_ctx.pd_ctx_table[1];
+
+    for (int i = 0; i < CORES_PER_CLUSTER; i++) {
+        core_pd_ctx[i].ppu = &core_ppu_table[i];
+        core_pd_ctx_table[i] = &core_pd_ctx[i];
+    }
+
+    cluster_pd_ctx_ut.core_pd_ctx_table = core_pd_ctx_table;
+    cluster_pd_ctx_ut.core_count = CORES_PER_CLUSTER;
+
+    cluster_pd_ctx->data = &cluster_pd_ctx_ut;
+    cluster_pd_ctx->timer_ctx = NULL;
+
+    return cluster_pd_ctx;
+}
+
 void setUp(void)
 {
     memset(&ppu_v1_ctx, 0, sizeof(ppu_v1_ctx));
@@ -158,6 +199,65 @@ void test_ppu_v1_core_pd_set_state_sleep(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+void test_core_dynamic_enable_retention(void)
+{
+    struct ppu_v1_pd_ctx *pd_ctx_temp;
+    struct mod_ppu_v1_pd_config config = pd_ppu_ctx_config[PD_PPU_IDX_0];
+
+    config.core_retention = MOD_PPU_V1_CORE_RETENTION_FUNC_RET;
+    pd_ctx_temp = &ppu_v1_ctx.pd_ctx_table[0];
+    pd_ctx_temp->config = &config;
+
+    /* The retention is entered by the hardware, the interrupt stays masked */
+    ppu_v1_interrupt_mask_Expect(
+        pd_ctx_temp->ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(pd_ctx_temp->ppu, false);
+    ppu_v1_dynamic_enable_Expect(pd_ctx_temp->ppu, PPU_V1_MODE_FUNC_RET);
+
+    core_dynamic_enable(pd_ctx_temp);
+}
+
+void test_core_dynamic_enable_already_enabled(void)
+{
+    struct ppu_v1_pd_ctx *pd_ctx_temp;
+    struct mod_ppu_v1_pd_config config = pd_ppu_ctx_config[PD_PPU_IDX_0];
+
+    config.core_retention = MOD_PPU_V1_CORE_RETENTION_MEM_RET;
+    pd_ctx_temp = &ppu_v1_ctx.pd_ctx_table[0];
+    pd_ctx_temp->config = &config;
+
+    /* The PPU already has the policy, it is not programmed again */
+    ppu_v1_interrupt_mask_Expect(
+        pd_ctx_temp->ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(pd_ctx_temp->ppu, true);
+    ppu_v1_get_programmed_power_mode_ExpectAndReturn(
+        pd_ctx_temp->ppu, PPU_V1_MODE_MEM_RET);
+
+    core_dynamic_enable(pd_ctx_temp);
+}
+
+void test_ppu_v1_core_pd_get_state_retention(void)
+{
+    int status;
+    unsigned int state;
+    fwk_id_t core_pd_id;
+    struct ppu_v1_pd_ctx *pd_ctx_temp;
+    struct mod_ppu_v1_pd_config config = pd_ppu_ctx_config[PD_PPU_IDX_0];
+
+    config.core_retention = MOD_PPU_V1_CORE_RETENTION_MEM_RET;
+    pd_ctx_temp = &ppu_v1_ctx.pd_ctx_table[0];
+    pd_ctx_temp->config = &config;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    ppu_v1_get_power_mode_ExpectAndReturn(
+        pd_ctx_temp->ppu, PPU_V1_MODE_MEM_RET);
+
+    status = ppu_v1_core_pd_get_state(core_pd_id, &state);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, state);
+}
+
 void test_start_deeper_locking_alarm(void)
 {
     int status;
@@ -205,6 +305,76 @@ void test_deeper_locking_alarm_callback(void)
     deeper_locking_alarm_callback(param);
 }
 
+void test_lock_all_dynamic_cores(void)
+{
+    struct ppu_v1_pd_ctx *cluster_pd_ctx = set_up_cluster();
+
+    /* The locks of all the cores are requested before waiting */
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_lock_off_enable_Expect(&core_ppu_table[0]);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], true);
+    ppu_v1_lock_off_enable_Expect(&core_ppu_table[1]);
+
+    /* First check, only the second core is locked */
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[0], PPU_V1_MODE_ON, false);
+    ppu_v1_is_locked_ExpectAndReturn(&core_ppu_table[0], false);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[1], PPU_V1_MODE_ON, false);
+    ppu_v1_is_locked_ExpectAndReturn(&core_ppu_table[1], true);
+
+    /* Second check, both cores are locked */
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[0], PPU_V1_MODE_ON, false);
+    ppu_v1_is_locked_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[1], PPU_V1_MODE_ON, false);
+    ppu_v1_is_locked_ExpectAndReturn(&core_ppu_table[1], true);
+
+    TEST_ASSERT_TRUE(lock_all_dynamic_cores(cluster_pd_ctx));
+}
+
+void test_lock_all_dynamic_cores_core_on_request(void)
+{
+    struct ppu_v1_pd_ctx *cluster_pd_ctx = set_up_cluster();
+
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_lock_off_enable_Expect(&core_ppu_table[0]);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], true);
+    ppu_v1_lock_off_enable_Expect(&core_ppu_table[1]);
+
+    /* The first core is requested on, the wait ends without checking more */
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[0], PPU_V1_MODE_ON, true);
+
+    TEST_ASSERT_FALSE(lock_all_dynamic_cores(cluster_pd_ctx));
+}
+
+void test_lock_all_dynamic_cores_timeout(void)
+{
+    struct ppu_v1_pd_ctx *cluster_pd_ctx = set_up_cluster();
+
+    cluster_pd_ctx->timer_ctx = &cluster_timer_ctx;
+
+    /* The second core is not in dynamic mode and is not locked */
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_lock_off_enable_Expect(&core_ppu_table[0]);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], false);
+
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[0], true);
+    ppu_v1_is_power_devactive_high_ExpectAndReturn(
+        &core_ppu_table[0], PPU_V1_MODE_ON, false);
+    ppu_v1_is_locked_ExpectAndReturn(&core_ppu_table[0], false);
+    ppu_v1_is_dynamic_enabled_ExpectAndReturn(&core_ppu_table[1], false);
+
+    TEST_ASSERT_FALSE(lock_all_dynamic_cores(cluster_pd_ctx));
+}
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -213,9 +383,15 @@ int scmi_test_main(void)
     RUN_TEST(test_ppu_v1_pd_init_error);
     RUN_TEST(test_ppu_v1_pd_init);
     RUN_TEST(test_ppu_v1_core_pd_set_state_sleep);
+    RUN_TEST(test_core_dynamic_enable_retention);
+    RUN_TEST(test_core_dynamic_enable_already_enabled);
+    RUN_TEST(test_ppu_v1_core_pd_get_state_retention);
     RUN_TEST(test_start_deeper_locking_alarm);
     RUN_TEST(test_start_deeper_locking_alarm_null_api);
     RUN_TEST(test_deeper_locking_alarm_callback);
+    RUN_TEST(test_lock_all_dynamic_cores);
+    RUN_TEST(test_lock_all_dynamic_cores_core_on_request);
+    RUN_TEST(test_lock_all_dynamic_cores_timeout);
 
     return UNITY_END();
 }
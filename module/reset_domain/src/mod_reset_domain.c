@@ -8,12 +8,15 @@
  *     Reset domain HAL
  */
 
+#include <fwk_id.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_notification.h>
 #include <mod_reset_domain.h>
 
+#include <limits.h>
+
 /*
  * Module and devices contexts for Reset Domain
  */
@@ -29,6 +32,15 @@ struct mod_rd_ctx {
     const struct mod_reset_domain_config *config;
     struct rd_dev_ctx *dev_ctx_table;
     unsigned int dev_count;
+
+#ifdef BUILD_HAS_NOTIFICATION
+    /*
+     * Reset domain index for each driver element index, used to resolve the
+     * domain of an auto reset completion without walking the device table.
+     */
+    unsigned int *domain_idx_table;
+    unsigned int domain_idx_table_size;
+#endif
 };
 
 /*
@@ -65,6 +77,7 @@ static int reset_issued_notify(fwk_id_t dev_id,
 {
     int domain_id = -1;
     unsigned int i;
+    unsigned int dev_idx;
     struct rd_dev_ctx *reset_ctx;
     unsigned int notification_count;
     struct fwk_event notification_event = {
@@ -76,8 +89,26 @@ static int reset_issued_notify(fwk_id_t dev_id,
         (struct mod_reset_domain_notification_event_params*)
         notification_event.params;
 
-    /* Loop through device context table to get the associated domain_id */
-    for (i = 0; i < module_reset_ctx.dev_count; i++) {
+    /* Look the domain up by the element index of its driver device first */
+    if (fwk_id_is_type(dev_id, FWK_ID_TYPE_ELEMENT)) {
+        dev_idx = fwk_id_get_element_idx(dev_id);
+
+        if (dev_idx < module_reset_ctx.domain_idx_table_size) {
+            i = module_reset_ctx.domain_idx_table[dev_idx];
+            if ((i < module_reset_ctx.dev_count) &&
+                fwk_id_is_equal(
+                    module_reset_ctx.dev_ctx_table[i].config->driver_id,
+                    dev_id)) {
+                domain_id = (int)i;
+            }
+        }
+    }
+
+    /*
+     * Loop through device context table to get the associated domain_id when
+     * several driver modules share the same element indices.
+     */
+    for (i = 0; (domain_id < 0) && (i < module_reset_ctx.dev_count); i++) {
         reset_ctx = &module_reset_ctx.dev_ctx_table[i];
         if (fwk_id_is_equal(reset_ctx->config->driver_id, dev_id)) {
             domain_id = (int)i;
@@ -146,6 +177,53 @@ static int rd_element_init(fwk_id_t element_id,
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_NOTIFICATION
+static int rd_post_init(fwk_id_t module_id)
+{
+    unsigned int i;
+    unsigned int dev_idx;
+    unsigned int table_size = 0;
+    fwk_id_t driver_id;
+
+    for (i = 0; i < module_reset_ctx.dev_count; i++) {
+        driver_id = module_reset_ctx.dev_ctx_table[i].config->driver_id;
+        if (fwk_id_is_type(driver_id, FWK_ID_TYPE_ELEMENT)) {
+            dev_idx = fwk_id_get_element_idx(driver_id);
+            if (dev_idx >= table_size) {
+                table_size = dev_idx + 1;
+            }
+        }
+    }
+
+    if (table_size == 0) {
+        return FWK_SUCCESS;
+    }
+
+    module_reset_ctx.domain_idx_table =
+        fwk_mm_alloc(table_size, sizeof(module_reset_ctx.domain_idx_table[0]));
+    module_reset_ctx.domain_idx_table_size = table_size;
+
+    for (dev_idx = 0; dev_idx < table_size; dev_idx++) {
+        module_reset_ctx.domain_idx_table[dev_idx] = UINT_MAX;
+    }
+
+    /* On a collision the first domain wins, the others are searched for */
+    for (i = 0; i < module_reset_ctx.dev_count; i++) {
+        driver_id = module_reset_ctx.dev_ctx_table[i].config->driver_id;
+        if (!fwk_id_is_type(driver_id, FWK_ID_TYPE_ELEMENT)) {
+            continue;
+        }
+
+        dev_idx = fwk_id_get_element_idx(driver_id);
+        if (module_reset_ctx.domain_idx_table[dev_idx] == UINT_MAX) {
+            module_reset_ctx.domain_idx_table[dev_idx] = i;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif /* BUILD_HAS_NOTIFICATION */
+
 static int rd_bind(fwk_id_t id, unsigned int round)
 {
     struct rd_dev_ctx *reset_ctx = NULL;
@@ -193,6 +271,9 @@ const struct fwk_module module_reset_domain = {
     .event_count = (unsigned int)MOD_RESET_DOMAIN_EVENT_IDX_COUNT,
     .init = rd_init,
     .element_init = rd_element_init,
+#ifdef BUILD_HAS_NOTIFICATION
+    .post_init = rd_post_init,
+#endif
     .bind = rd_bind,
     .process_bind_request = rd_process_bind_request,
     .process_event = rd_process_event,
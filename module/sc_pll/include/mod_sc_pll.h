@@ -93,6 +93,20 @@ struct mod_sc_pll_dev_config {
 
     /*! PLL Device Parameters used to configure it during init time */
     struct mod_sc_pll_dev_param *dev_param;
+
+    /*!
+     * \brief Optional table of the rates the PLL is expected to be set to.
+     *
+     * \details The divider settings of these rates are computed once during
+     *      the element initialization, so that setting one of them does not
+     *      require searching for the divider settings. Other rates are still
+     *      supported. If it is left NULL every rate change searches for its
+     *      divider settings.
+     */
+    const uint64_t *rate_table;
+
+    /*! The number of rates in the rate table. */
+    const size_t rate_count;
 };
 
 /*!
@@ -27,6 +27,22 @@
 
 #define FREQ_TOLERANCE_HZ 10000
 
+/* PLL divider settings for a rate */
+struct sc_pll_params {
+    /* Output rate */
+    uint64_t rate;
+
+    /* Feedback divider */
+    uint16_t fbdiv;
+
+    /* Reference divider */
+    uint8_t refdiv;
+
+    /* Post dividers */
+    uint8_t postdiv1;
+    uint8_t postdiv2;
+};
+
 /* Device context */
 struct sc_pll_dev_ctx {
     /* Configuration data of the PLL instance */
@@ -40,6 +56,12 @@ struct sc_pll_dev_ctx {
 
     /* Initialization state of the PLL */
     bool initialized;
+
+    /* Divider settings precomputed for the configured rate table */
+    struct sc_pll_params *params_table;
+
+    /* Number of entries in the precomputed divider settings table */
+    size_t params_count;
 };
 
 /* Module context */
@@ -61,10 +83,9 @@ static inline struct sc_pll_dev_ctx *get_ctx(fwk_id_t dev_id)
     return module_ctx.dev_ctx_table + fwk_id_get_element_idx(dev_id);
 }
 
-static inline bool check_fbdiv_within_range(uint16_t fbdiv_d)
+static inline bool check_fbdiv_within_range(uint64_t fbdiv)
 {
-    return (
-        (fbdiv_d >= MOD_SC_PLL_FBDIV_MIN) && (fbdiv_d <= MOD_SC_PLL_FBDIV_MAX));
+    return ((fbdiv >= MOD_SC_PLL_FBDIV_MIN) && (fbdiv <= MOD_SC_PLL_FBDIV_MAX));
 }
 /*
  * Write the calculated PLL parameters to control register
@@ -110,21 +131,18 @@ static int pll_write(
 
 /*
  * Pinpoint postdiv1 & 2, then find the refdiv and fbdiv within the valid
- * threshold
+ * threshold. Only integer arithmetic is used, as the PLL driver may run on
+ * cores without a floating-point unit.
  */
 static int pll_calc_fbdiv(
-    struct sc_pll_dev_ctx *ctx,
+    const struct mod_sc_pll_dev_config *config,
     uint64_t rate,
     uint8_t postdiv1,
-    uint8_t postdiv2)
+    uint8_t postdiv2,
+    struct sc_pll_params *params)
 {
-    float fbdiv_f, fvco, fout;
-    uint16_t fbdiv_d;
+    uint64_t fbdiv, fvco, fout, diff;
     uint8_t refdiv;
-    int64_t diff;
-    const struct mod_sc_pll_dev_config *config = NULL;
-
-    config = ctx->config;
 
     /* Check if REF input is valid range (2MHz - 1200MHz) */
     if (config->ref_rate < MOD_SC_PLL_REF_MIN ||
@@ -134,34 +152,33 @@ static int pll_calc_fbdiv(
 
     for (refdiv = MOD_SC_PLL_REFDIV_MIN; refdiv <= MOD_SC_PLL_REFDIV_MAX;
          refdiv++) {
-        fbdiv_f = (float)(rate * postdiv1 * postdiv2 * refdiv) /
-            (float)config->ref_rate;
-        fbdiv_d = (uint16_t)fbdiv_f;
-
-        /* Round fbdiv_d to nearest integer */
-        fbdiv_d = ((fbdiv_f - (float)fbdiv_d) < 0.5) ? fbdiv_d : fbdiv_d + 1;
+        /* Round fbdiv to nearest integer */
+        fbdiv = ((rate * postdiv1 * postdiv2 * refdiv) +
+                 (config->ref_rate / 2)) /
+            config->ref_rate;
 
-        /* Check if fbdiv_d is in valid range */
-        if ((fbdiv_d < MOD_SC_PLL_FBDIV_MIN) ||
-            (fbdiv_d > MOD_SC_PLL_FBDIV_MAX)) {
+        /* Check if fbdiv is in valid range */
+        if (!check_fbdiv_within_range(fbdiv)) {
             continue;
         }
 
-        fvco = (((float)config->ref_rate / (float)refdiv) * (float)fbdiv_d);
+        fvco = (config->ref_rate * fbdiv) / refdiv;
         /* Check if VCO output is in valid range */
-        if ((fvco < (float)MOD_SC_PLL_FVCO_MIN) ||
-            (fvco > (float)MOD_SC_PLL_FVCO_MAX)) {
+        if ((fvco < MOD_SC_PLL_FVCO_MIN) || (fvco > MOD_SC_PLL_FVCO_MAX)) {
             continue;
         }
 
-        fout = (fvco / (float)postdiv1) / (float)postdiv2;
-        diff = (uint64_t)fout - rate;
-        if (diff < 0) {
-            diff = diff * -1;
-        }
+        fout = fvco / (postdiv1 * postdiv2);
+        diff = (fout > rate) ? (fout - rate) : (rate - fout);
 
         if (diff <= FREQ_TOLERANCE_HZ) {
-            return pll_write(ctx, postdiv1, postdiv2, refdiv, fbdiv_d, rate);
+            params->rate = rate;
+            params->fbdiv = (uint16_t)fbdiv;
+            params->refdiv = refdiv;
+            params->postdiv1 = postdiv1;
+            params->postdiv2 = postdiv2;
+
+            return FWK_SUCCESS;
         }
     }
     return FWK_E_SUPPORT;
@@ -171,22 +188,19 @@ static int pll_calc_fbdiv(
  * Calculate the Post Divider and Feedback
  */
 static int pll_calc_post_divider_and_feedback_params(
-    struct sc_pll_dev_ctx *ctx,
+    const struct mod_sc_pll_dev_config *config,
     uint64_t rate,
-    uint8_t postdiv2)
+    uint8_t postdiv2,
+    struct sc_pll_params *params)
 {
     uint8_t postdiv1;
-    int status;
-    const struct mod_sc_pll_dev_config *config = NULL;
-
-    config = ctx->config;
 
     for (postdiv1 = config->dev_param->postdiv1_min;
          postdiv1 <= config->dev_param->postdiv1_max;
          postdiv1++) {
-        status = pll_calc_fbdiv(ctx, rate, postdiv1, postdiv2);
-        if ((status == FWK_SUCCESS) || (status == FWK_E_TIMEOUT)) {
-            return status;
+        if (pll_calc_fbdiv(config, rate, postdiv1, postdiv2, params) ==
+            FWK_SUCCESS) {
+            return FWK_SUCCESS;
         }
     }
     return FWK_E_SUPPORT;
@@ -195,33 +209,86 @@ static int pll_calc_post_divider_and_feedback_params(
 /*
  * Pinpoint the first postdiv and iterate
  */
-static int pll_fractional_calc(struct sc_pll_dev_ctx *ctx, uint64_t rate)
+static int pll_fractional_calc(
+    const struct mod_sc_pll_dev_config *config,
+    uint64_t rate,
+    struct sc_pll_params *params)
 {
     uint8_t postdiv2;
-    int status;
-    const struct mod_sc_pll_dev_config *config = NULL;
-
-    config = ctx->config;
 
     for (postdiv2 = config->dev_param->postdiv2_min;
          postdiv2 <= config->dev_param->postdiv2_max;
          postdiv2++) {
-        status = pll_calc_post_divider_and_feedback_params(ctx, rate, postdiv2);
-        if ((status == FWK_SUCCESS) || (status == FWK_E_TIMEOUT)) {
-            return status;
+        if (pll_calc_post_divider_and_feedback_params(
+                config, rate, postdiv2, params) == FWK_SUCCESS) {
+            return FWK_SUCCESS;
         }
     }
 
     return FWK_E_SUPPORT;
 }
 
+/*
+ * Calculate the PLL divider settings for a rate
+ */
+static int pll_calc_params(
+    const struct mod_sc_pll_dev_config *config,
+    uint64_t rate,
+    struct sc_pll_params *params)
+{
+    uint64_t fbdiv;
+
+    /*
+     * If requested frequency is integer multiple of reference frequency
+     * then the fbdiv calculation is a simple division provided it is
+     * within the valid range.
+     */
+    if ((rate % config->ref_rate) == 0) {
+        fbdiv = rate / config->ref_rate;
+        if (check_fbdiv_within_range(fbdiv)) {
+            params->rate = rate;
+            params->fbdiv = (uint16_t)fbdiv;
+            params->refdiv = 1;
+            params->postdiv1 = 1;
+            params->postdiv2 = 1;
+
+            return FWK_SUCCESS;
+        }
+    }
+
+    /*
+     * If requested frequency is not an integer multiple of reference frequency
+     * then fine tune the parameters ( fbdiv, postdiv1, postdiv2, refdiv )
+     */
+    return pll_fractional_calc(config, rate, params);
+}
+
+/*
+ * Look up the divider settings precomputed for a rate
+ */
+static const struct sc_pll_params *pll_find_params(
+    const struct sc_pll_dev_ctx *ctx,
+    uint64_t rate)
+{
+    size_t idx;
+
+    for (idx = 0; idx < ctx->params_count; idx++) {
+        if (ctx->params_table[idx].rate == rate) {
+            return &ctx->params_table[idx];
+        }
+    }
+
+    return NULL;
+}
+
 /*
  * PLL rate configuration function
  */
 static int pll_set_rate(struct sc_pll_dev_ctx *ctx, uint64_t rate)
 {
-    uint16_t fbdiv_d;
-    uint8_t postdiv1, postdiv2, refdiv;
+    int status;
+    struct sc_pll_params params;
+    const struct sc_pll_params *found;
     const struct mod_sc_pll_dev_config *config = NULL;
 
     if (ctx == NULL) {
@@ -243,27 +310,24 @@ static int pll_set_rate(struct sc_pll_dev_ctx *ctx, uint64_t rate)
         return FWK_E_RANGE;
     }
 
-    /*
-     * If requested frequency is integer multiple of reference frequency
-     * then the fbdiv_d calculation is a simple division provided it is
-     * within the valid range.
-     */
-    if ((rate % config->ref_rate) == 0) {
-        fbdiv_d = rate / config->ref_rate;
-        if (check_fbdiv_within_range(fbdiv_d)) {
-            refdiv = 1;
-            postdiv1 = 1;
-            postdiv2 = 1;
-            return pll_write(ctx, postdiv1, postdiv2, refdiv, fbdiv_d, rate);
+    found = pll_find_params(ctx, rate);
+    if (found == NULL) {
+        status = pll_calc_params(config, rate, &params);
+        if (status != FWK_SUCCESS) {
+            return status;
         }
+
+        found = &params;
     }
 
-    /*
-     * If requested frequency is not an integer multiple of reference frequency
-     * then fine tune the parameters ( fbdiv, postdiv1, postdiv2, refdiv )
-     * This values will then written to PLL control registers.
-     */
-    return pll_fractional_calc(ctx, rate);
+    /* These values are then written to the PLL control registers */
+    return pll_write(
+        ctx,
+        found->postdiv1,
+        found->postdiv2,
+        found->refdiv,
+        found->fbdiv,
+        rate);
 }
 
 /*
@@ -437,12 +501,46 @@ static int sc_pll_init(
     return FWK_SUCCESS;
 }
 
+/*
+ * Compute the divider settings of the configured rates once, so that setting
+ * one of them does not need a search.
+ */
+static int pll_precompute_params(struct sc_pll_dev_ctx *ctx)
+{
+    const struct mod_sc_pll_dev_config *config = ctx->config;
+    size_t idx;
+    int status;
+
+    if (config->rate_count == 0) {
+        return FWK_E_PARAM;
+    }
+
+    ctx->params_table =
+        fwk_mm_calloc(config->rate_count, sizeof(struct sc_pll_params));
+
+    for (idx = 0; idx < config->rate_count; idx++) {
+        status = pll_calc_params(
+            config, config->rate_table[idx], &ctx->params_table[idx]);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_ERR(
+                "[SC PLL] No divider settings for rate %lu Hz",
+                (unsigned long)config->rate_table[idx]);
+            return FWK_E_PARAM;
+        }
+    }
+
+    ctx->params_count = config->rate_count;
+
+    return FWK_SUCCESS;
+}
+
 static int sc_pll_element_init(
     fwk_id_t dev_id,
     unsigned int unused,
     const void *data)
 {
     struct sc_pll_dev_ctx *ctx;
+    int status;
 
     if (data == NULL) {
         return FWK_E_DATA;
@@ -458,6 +556,13 @@ static int sc_pll_element_init(
         return FWK_E_PARAM;
     }
 
+    if (ctx->config->rate_table != NULL) {
+        status = pll_precompute_params(ctx);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
     ctx->initialized = true;
     ctx->current_state = MOD_CLOCK_STATE_RUNNING;
     return pll_set_rate(ctx, ctx->config->initial_rate);
@@ -9,6 +9,7 @@
 #include "unity.h"
 
 #include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
 #include <Mockfwk_module.h>
 
 #include <fwk_element.h>
@@ -27,6 +28,16 @@
 #define FAKE_RATE      1466
 #define LARGE_REF_RATE 1300 * FWK_MHZ
 
+/* Divider settings of SC_PLL_RATE_CPU_PLL0 */
+#define FRACTIONAL_REFDIV   50
+#define FRACTIONAL_FBDIV    1333
+#define FRACTIONAL_POSTDIV1 1
+
+static const uint64_t rate_table[] = {
+    SC_PLL_RATE_CPU_PLL0,
+    2600 * FWK_MHZ,
+};
+
 struct sc_pll_dev_ctx dev_ctx_table[FWK_ELEMENT_IDX_COUNT];
 
 void setUp(void)
@@ -39,6 +50,8 @@ void setUp(void)
     for (dev_idx = 0; dev_idx < FWK_ELEMENT_IDX_COUNT; dev_idx++) {
         dev_ctx = &dev_ctx_table[dev_idx];
         dev_ctx->config = sc_pll_element_table[dev_idx].data;
+        dev_ctx->params_table = NULL;
+        dev_ctx->params_count = 0;
     }
 }
 
@@ -97,6 +110,107 @@ void test_pll_device_init_success(void)
         fwk_element_id_dummy, 0, sc_pll_element_table[0].data);
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
+/*!
+ * \brief pll unit test: pll_element_init(), rate table.
+ *
+ *  \details Handle case in pll_element_init() where the divider settings of
+ *       the configured rates are precomputed.
+ */
+void test_pll_device_init_rate_table(void)
+{
+    int status;
+    struct sc_pll_params params_table[FWK_ARRAY_SIZE(rate_table)];
+    struct sc_pll_dev_ctx *ctx = &dev_ctx_table[0];
+    const struct mod_sc_pll_dev_config config = {
+        .control_reg0 = &control_reg0,
+        .control_reg1 = &control_reg1,
+        .initial_rate = SC_PLL_RATE_CPU_PLL0,
+        .ref_rate = CLOCK_RATE_REFCLK,
+        .dev_param = &dev_param,
+        .rate_table = rate_table,
+        .rate_count = FWK_ARRAY_SIZE(rate_table),
+    };
+
+    fwk_id_get_element_idx_ExpectAndReturn(fwk_element_id_dummy, 0);
+    fwk_mm_calloc_ExpectAndReturn(
+        FWK_ARRAY_SIZE(rate_table), sizeof(struct sc_pll_params), params_table);
+
+    status = sc_pll_element_init(fwk_element_id_dummy, 0, &config);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(ctx->params_count, FWK_ARRAY_SIZE(rate_table));
+
+    TEST_ASSERT_EQUAL(params_table[0].rate, SC_PLL_RATE_CPU_PLL0);
+    TEST_ASSERT_EQUAL(params_table[0].refdiv, FRACTIONAL_REFDIV);
+    TEST_ASSERT_EQUAL(params_table[0].fbdiv, FRACTIONAL_FBDIV);
+    TEST_ASSERT_EQUAL(params_table[0].postdiv1, FRACTIONAL_POSTDIV1);
+
+    TEST_ASSERT_EQUAL(params_table[1].rate, 2600 * FWK_MHZ);
+    TEST_ASSERT_EQUAL(params_table[1].refdiv, 1);
+    TEST_ASSERT_EQUAL(params_table[1].fbdiv, 52);
+    TEST_ASSERT_EQUAL(params_table[1].postdiv1, 1);
+}
+/*!
+ * \brief pll unit test: pll_element_init(), unsupported rate in the table.
+ *
+ *  \details Handle case in pll_element_init() where a configured rate cannot
+ *       be generated by the PLL.
+ */
+void test_pll_device_init_rate_table_fail(void)
+{
+    int status;
+    struct sc_pll_params params_table[1];
+    const uint64_t invalid_rate_table[] = { 10 * FWK_MHZ };
+    const struct mod_sc_pll_dev_config config = {
+        .control_reg0 = &control_reg0,
+        .control_reg1 = &control_reg1,
+        .initial_rate = SC_PLL_RATE_CPU_PLL0,
+        .ref_rate = CLOCK_RATE_REFCLK,
+        .dev_param = &dev_param,
+        .rate_table = invalid_rate_table,
+        .rate_count = FWK_ARRAY_SIZE(invalid_rate_table),
+    };
+
+    fwk_id_get_element_idx_ExpectAndReturn(fwk_element_id_dummy, 0);
+    fwk_mm_calloc_ExpectAndReturn(
+        1, sizeof(struct sc_pll_params), params_table);
+
+    status = sc_pll_element_init(fwk_element_id_dummy, 0, &config);
+    TEST_ASSERT_EQUAL(status, FWK_E_PARAM);
+}
+/*!
+ * \brief pll unit test: pll_set_rate(), precomputed rate.
+ *
+ *  \details Handle case in pll_set_rate() where the divider settings of the
+ *       rate are taken from the precomputed table.
+ */
+void test_pll_set_rate_precomputed(void)
+{
+    int status;
+    struct sc_pll_dev_ctx *ctx = &dev_ctx_table[0];
+    struct sc_pll_params params_table[] = {
+        {
+            .rate = 2600 * FWK_MHZ,
+            .fbdiv = 104,
+            .refdiv = 2,
+            .postdiv1 = 1,
+            .postdiv2 = 1,
+        },
+    };
+
+    ctx->current_state = MOD_CLOCK_STATE_RUNNING;
+    ctx->params_table = params_table;
+    ctx->params_count = FWK_ARRAY_SIZE(params_table);
+
+    status = pll_set_rate(ctx, 2600 * FWK_MHZ);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(ctx->current_rate, 2600 * FWK_MHZ);
+
+    /* The precomputed settings are used instead of the computed ones */
+    TEST_ASSERT_EQUAL(
+        (control_reg0 >> PLL_FBDIV_BIT_POS) & 0xFFF, params_table[0].fbdiv);
+    TEST_ASSERT_EQUAL(
+        (control_reg0 >> PLL_REFDIV_POS) & 0x3F, params_table[0].refdiv);
+}
 /*!
  * \brief pll unit test: pll_process_bind_request(), invalid bind.
  *
@@ -233,8 +347,10 @@ void test_pll_get_state_success(void)
 void test_pll_calc_fbdiv_fail(void)
 {
     int status;
+    struct sc_pll_params params;
 
-    status = pll_calc_fbdiv(&dev_ctx_table[0], UINT32_MAX * FWK_MHZ, 1, 1);
+    status = pll_calc_fbdiv(
+        dev_ctx_table[0].config, UINT32_MAX * FWK_MHZ, 1, 1, &params);
 
     TEST_ASSERT_EQUAL(status, FWK_E_SUPPORT);
 }
@@ -248,10 +364,35 @@ void test_pll_calc_fbdiv_fail(void)
 void test_pll_calc_fbdiv_success(void)
 {
     int status;
+    struct sc_pll_params params;
+
+    status = pll_calc_fbdiv(
+        dev_ctx_table[0].config, (2600 * FWK_MHZ), 1, 1, &params);
+
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(params.refdiv, 1);
+    TEST_ASSERT_EQUAL(params.fbdiv, 52);
+}
+
+/*!
+ * \brief pll unit test: test_pll_calc_params_fractional
+ *
+ *  \details Handle case in test_pll_calc_params_fractional() with a rate that
+ *  is not a multiple of the reference rate.
+ */
+void test_pll_calc_params_fractional(void)
+{
+    int status;
+    struct sc_pll_params params;
 
-    status = pll_calc_fbdiv(&dev_ctx_table[0], (2600 * FWK_MHZ), 1, 1);
+    status = pll_calc_params(
+        dev_ctx_table[0].config, SC_PLL_RATE_CPU_PLL0, &params);
 
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(params.refdiv, FRACTIONAL_REFDIV);
+    TEST_ASSERT_EQUAL(params.fbdiv, FRACTIONAL_FBDIV);
+    TEST_ASSERT_EQUAL(params.postdiv1, FRACTIONAL_POSTDIV1);
+    TEST_ASSERT_EQUAL(params.postdiv2, 1);
 }
 
 /*!
@@ -265,6 +406,7 @@ void test_pll_calc_fbdiv_small_config_ref_rate(void)
 {
     int status;
     struct sc_pll_dev_ctx ctx;
+    struct sc_pll_params params;
     const struct mod_sc_pll_dev_config config = {
         .ref_rate = 1 * FWK_MHZ,
         .control_reg0 = &control_reg0,
@@ -273,7 +415,7 @@ void test_pll_calc_fbdiv_small_config_ref_rate(void)
         .dev_param = &dev_param,
     };
     ctx.config = &config;
-    status = pll_calc_fbdiv(&ctx, (2600 * FWK_MHZ), 1, 1);
+    status = pll_calc_fbdiv(ctx.config, (2600 * FWK_MHZ), 1, 1, &params);
     TEST_ASSERT_EQUAL(status, FWK_E_SUPPORT);
 }
 
@@ -287,6 +429,7 @@ void test_pll_calc_fbdiv_large_config_ref_rate(void)
 {
     int status;
     struct sc_pll_dev_ctx ctx;
+    struct sc_pll_params params;
     const struct mod_sc_pll_dev_config config = {
         .ref_rate = LARGE_REF_RATE,
         .control_reg0 = &control_reg0,
@@ -295,7 +438,7 @@ void test_pll_calc_fbdiv_large_config_ref_rate(void)
         .dev_param = &dev_param,
     };
     ctx.config = &config;
-    status = pll_calc_fbdiv(&ctx, (2600 * FWK_MHZ), 1, 1);
+    status = pll_calc_fbdiv(ctx.config, (2600 * FWK_MHZ), 1, 1, &params);
     TEST_ASSERT_EQUAL(status, FWK_E_SUPPORT);
 }
 
@@ -341,16 +484,20 @@ int pll_test_main(void)
     RUN_TEST(test_pll_init_success);
     RUN_TEST(test_pll_device_init_fail);
     RUN_TEST(test_pll_device_init_success);
+    RUN_TEST(test_pll_device_init_rate_table);
+    RUN_TEST(test_pll_device_init_rate_table_fail);
     RUN_TEST(test_pll_process_bind_request_fail);
     RUN_TEST(test_pll_process_bind_request_success);
     RUN_TEST(test_pll_set_rate_fail);
     RUN_TEST(test_pll_set_rate_success);
+    RUN_TEST(test_pll_set_rate_precomputed);
     RUN_TEST(test_pll_get_rate_fail);
     RUN_TEST(test_pll_get_rate_success);
     RUN_TEST(test_pll_get_state_fail);
     RUN_TEST(test_pll_get_state_success);
     RUN_TEST(test_pll_calc_fbdiv_fail);
     RUN_TEST(test_pll_calc_fbdiv_success);
+    RUN_TEST(test_pll_calc_params_fractional);
     RUN_TEST(test_pll_calc_fbdiv_small_config_ref_rate);
     RUN_TEST(test_pll_calc_fbdiv_large_config_ref_rate);
     RUN_TEST(test_pll_write_success);
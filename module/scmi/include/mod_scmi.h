@@ -288,6 +288,35 @@ struct mod_scmi_to_transport_api {
     int (*write_payload)(fwk_id_t channel_id, size_t offset,
                          const void *payload, size_t size);
 
+    /*!
+     * \brief Get a writable view of the outbound payload area of a channel.
+     *
+     * \details The area returned is the one the response is finally read
+     *      from by the agent, e.g. the shared mailbox for out-band channels.
+     *      Passing its address as the `payload` parameter of the `respond`
+     *      function sends the response without copying it.
+     *
+     * \note This function is optional and may be NULL, in which case the
+     *      response builder of the SCMI module is not available on the
+     *      channel.
+     *
+     * \param channel_id Channel identifier.
+     * \param[out] payload Start of the outbound payload area.
+     * \param[out] size Size in bytes of the outbound payload area.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `payload` parameter was a null pointer value.
+     *      - The `size` parameter was a null pointer value.
+     * \retval ::FWK_E_ACCESS No message is available to respond to.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*get_response_buffer)(
+        fwk_id_t channel_id,
+        void **payload,
+        size_t *size);
+
     /*!
      * \brief Respond to an SCMI message on a channel.
      *
@@ -551,6 +580,28 @@ struct mod_scmi_notification_api {
 };
 #endif
 
+/*!
+ * \brief SCMI response builder.
+ *
+ * \details Bounded view of the outbound payload area of a service, filled
+ *      by sequential writes and sent in one step. The fields may be read by
+ *      the caller, e.g. to work out how many entries of a list still fit,
+ *      but must only be modified through the SCMI module API.
+ */
+struct mod_scmi_response_builder {
+    /*! Start of the outbound payload area */
+    uint8_t *payload;
+
+    /*! Size in bytes of the outbound payload area */
+    size_t capacity;
+
+    /*! Number of bytes written so far */
+    size_t length;
+
+    /*! A write did not fit in the payload area */
+    bool overflow;
+};
+
 /*!
  * \brief SCMI protocol module to SCMI module API.
  */
@@ -652,6 +703,95 @@ struct mod_scmi_from_protocol_api {
      */
     int (*respond)(fwk_id_t service_id, const void *payload, size_t size);
 
+    /*!
+     * \brief Start building a response directly in the outbound payload area
+     *      of a service.
+     *
+     * \details No state is held by the SCMI module until the response is
+     *      committed, so a builder may be abandoned and the message answered
+     *      through `respond` instead, e.g. on an error path.
+     *
+     * \param service_id Service identifier.
+     * \param[out] builder Response builder to initialize.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The `builder` parameter was a null pointer value.
+     * \retval ::FWK_E_SUPPORT The transport of the service does not expose
+     *      its outbound payload area.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*response_builder_init)(
+        fwk_id_t service_id,
+        struct mod_scmi_response_builder *builder);
+
+    /*!
+     * \brief Reserve space at the end of a response being built.
+     *
+     * \details The reserved space is returned for the caller to fill in
+     *      place, e.g. with an array of descriptors or with a header whose
+     *      content is only known once the rest of the response is written.
+     *
+     * \param builder Response builder.
+     * \param size Number of bytes to reserve.
+     *
+     * \return Start of the reserved space, or NULL if it does not fit in the
+     *      payload area. In the latter case the response is marked as
+     *      overflowed.
+     */
+    void *(*response_reserve)(
+        struct mod_scmi_response_builder *builder,
+        size_t size);
+
+    /*!
+     * \brief Append data to a response being built.
+     *
+     * \param builder Response builder.
+     * \param data Data to append.
+     * \param size Size in bytes of the data.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The `data` parameter was a null pointer value.
+     * \retval ::FWK_E_RANGE The data does not fit in the payload area.
+     */
+    int (*response_write)(
+        struct mod_scmi_response_builder *builder,
+        const void *data,
+        size_t size);
+
+    /*!
+     * \brief Append a 32-bit word to a response being built.
+     *
+     * \param builder Response builder.
+     * \param value Word to append.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_RANGE The word does not fit in the payload area.
+     */
+    int (*response_write_u32)(
+        struct mod_scmi_response_builder *builder,
+        uint32_t value);
+
+    /*!
+     * \brief Send a response built in the outbound payload area of a service.
+     *
+     * \details The length is padded to a multiple of 32 bits. A response
+     *      that overflowed the payload area is replaced with an
+     *      SCMI_GENERIC_ERROR status.
+     *
+     * \param service_id Service identifier.
+     * \param builder Response builder.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \retval ::FWK_E_PARAM The builder was not initialized.
+     * \retval ::FWK_E_RANGE The response overflowed the payload area.
+     * \return One of the standard error codes for implementation-defined
+     *      errors.
+     */
+    int (*response_commit)(
+        fwk_id_t service_id,
+        struct mod_scmi_response_builder *builder);
+
     /*!
      * \brief Validate received protocol message.
      *
@@ -380,6 +380,115 @@ static int respond(fwk_id_t service_id, const void *payload, size_t size)
     return status;
 }
 
+static int response_builder_init(
+    fwk_id_t service_id,
+    struct mod_scmi_response_builder *builder)
+{
+    int status;
+    const struct scmi_service_ctx *ctx;
+    void *payload;
+    size_t size;
+
+    if (builder == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    ctx = &scmi_ctx.service_ctx_table[fwk_id_get_element_idx(service_id)];
+
+    if (ctx->transport_api->get_response_buffer == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    status = ctx->transport_api->get_response_buffer(
+        ctx->transport_id, &payload, &size);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *builder = (struct mod_scmi_response_builder){
+        .payload = (uint8_t *)payload,
+        .capacity = size,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static void *response_reserve(
+    struct mod_scmi_response_builder *builder,
+    size_t size)
+{
+    void *area;
+
+    if (builder->overflow || (size > (builder->capacity - builder->length))) {
+        builder->overflow = true;
+        return NULL;
+    }
+
+    area = &builder->payload[builder->length];
+    builder->length += size;
+
+    return area;
+}
+
+static int response_write(
+    struct mod_scmi_response_builder *builder,
+    const void *data,
+    size_t size)
+{
+    void *area;
+
+    if (data == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    area = response_reserve(builder, size);
+    if (area == NULL) {
+        return FWK_E_RANGE;
+    }
+
+    fwk_str_memcpy(area, data, size);
+
+    return FWK_SUCCESS;
+}
+
+static int response_write_u32(
+    struct mod_scmi_response_builder *builder,
+    uint32_t value)
+{
+    return response_write(builder, &value, sizeof(value));
+}
+
+static int response_commit(
+    fwk_id_t service_id,
+    struct mod_scmi_response_builder *builder)
+{
+    int status;
+    size_t length;
+
+    if ((builder == NULL) || (builder->payload == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    if (builder->overflow) {
+        status = respond(
+            service_id, &(int32_t){ SCMI_GENERIC_ERROR }, sizeof(int32_t));
+
+        return (status != FWK_SUCCESS) ? status : FWK_E_RANGE;
+    }
+
+    length = FWK_ALIGN_NEXT(builder->length, sizeof(uint32_t));
+    if (length > builder->capacity) {
+        length = builder->length;
+    }
+
+    /* Do not leak stale mailbox content through the padding */
+    fwk_str_memset(
+        &builder->payload[builder->length], 0, length - builder->length);
+
+    /* The transport recognises its own buffer and skips the copy */
+    return respond(service_id, builder->payload, length);
+}
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
 static int scmi_permissions_handler(
     fwk_id_t service_id,
@@ -592,6 +701,11 @@ static const struct mod_scmi_from_protocol_api scmi_from_protocol_api = {
     .get_max_payload_size = get_max_payload_size,
     .write_payload = write_payload,
     .respond = respond,
+    .response_builder_init = response_builder_init,
+    .response_reserve = response_reserve,
+    .response_write = response_write,
+    .response_write_u32 = response_write_u32,
+    .response_commit = response_commit,
     .scmi_message_validation = scmi_message_validation,
     .notify = scmi_notify,
 };
@@ -319,9 +319,9 @@ static int scmi_base_discover_list_protocols_handler(
         .status = (int32_t)SCMI_GENERIC_ERROR,
         .num_protocols = 0,
     };
+    struct scmi_base_discover_list_protocols_p2a *response_header;
+    struct mod_scmi_response_builder response;
     unsigned int skip;
-    size_t max_payload_size;
-    size_t payload_size;
     size_t entry_count;
     size_t protocol_count, protocol_count_max;
     size_t avail_protocol_count = 0;
@@ -348,20 +348,28 @@ static int scmi_base_discover_list_protocols_handler(
     }
 #endif
 
-    status = protocol_api->get_max_payload_size(service_id, &max_payload_size);
+    /* The protocol list is built directly in the outbound payload area */
+    status = protocol_api->response_builder_init(service_id, &response);
     if (status != FWK_SUCCESS) {
         goto error;
     }
 
-    if (max_payload_size <
+    if (response.capacity <
         (sizeof(struct scmi_base_discover_list_protocols_p2a) +
          sizeof(return_values.protocols[0]))) {
         status = FWK_E_SIZE;
         goto error;
     }
 
-    entry_count =
-        max_payload_size - sizeof(struct scmi_base_discover_list_protocols_p2a);
+    /* The header is filled in once the number of protocols is known */
+    response_header = protocol_api->response_reserve(
+        &response, sizeof(struct scmi_base_discover_list_protocols_p2a));
+    if (response_header == NULL) {
+        status = FWK_E_SIZE;
+        goto error;
+    }
+
+    entry_count = response.capacity - response.length;
 
     parameters = (const struct scmi_base_discover_list_protocols_a2p *)payload;
     skip = parameters->skip;
@@ -392,9 +400,7 @@ static int scmi_base_discover_list_protocols_handler(
     }
 #endif
 
-    for (index = 0,
-        protocol_count = 0,
-        payload_size = sizeof(struct scmi_base_discover_list_protocols_p2a);
+    for (index = 0, protocol_count = 0;
          (index < FWK_ARRAY_SIZE(shared_scmi_ctx->scmi_protocol_id_to_idx)) &&
          (protocol_count < protocol_count_max);
          index++) {
@@ -461,12 +467,11 @@ static int scmi_base_discover_list_protocols_handler(
             continue;
         }
 
-        status = protocol_api->write_payload(
-            service_id, payload_size, &protocol_id, sizeof(protocol_id));
+        status = protocol_api->response_write(
+            &response, &protocol_id, sizeof(protocol_id));
         if (status != FWK_SUCCESS) {
             goto error;
         }
-        payload_size += sizeof(protocol_id);
         avail_protocol_count++;
     }
 
@@ -475,18 +480,10 @@ static int scmi_base_discover_list_protocols_handler(
         goto error;
     }
 
-    return_values.status = (int32_t)SCMI_SUCCESS;
-    return_values.num_protocols = (uint32_t)avail_protocol_count;
-
-    status = protocol_api->write_payload(
-        service_id, 0, &return_values, sizeof(return_values));
-    if (status != FWK_SUCCESS) {
-        goto error;
-    }
-
-    payload_size = FWK_ALIGN_NEXT(payload_size, sizeof(uint32_t));
+    response_header->status = (int32_t)SCMI_SUCCESS;
+    response_header->num_protocols = (uint32_t)avail_protocol_count;
 
-    return protocol_api->respond(service_id, NULL, payload_size);
+    return protocol_api->response_commit(service_id, &response);
 
 error:
     respond_status = protocol_api->respond(
@@ -113,12 +113,26 @@ struct mod_scmi_to_protocol_api to_protocol_api = {
 #endif
 };
 
+static uint32_t fake_response_buffer[4];
+
+static int fake_get_response_buffer(
+    fwk_id_t channel_id,
+    void **payload,
+    size_t *size)
+{
+    *payload = fake_response_buffer;
+    *size = sizeof(fake_response_buffer);
+
+    return FWK_SUCCESS;
+}
+
 static struct mod_scmi_to_transport_api to_transport_api = {
     .get_secure = mod_scmi_to_transport_api_get_secure,
     .get_max_payload_size = mod_scmi_to_transport_api_get_max_payload_size,
     .get_message_header = mod_scmi_to_transport_api_get_message_header,
     .get_payload = mod_scmi_to_transport_api_get_payload,
     .write_payload = mod_scmi_to_transport_api_write_payload,
+    .get_response_buffer = fake_get_response_buffer,
     .respond = mod_scmi_to_transport_api_respond,
     .transmit = mod_scmi_to_transport_api_transmit,
     .release_transport_channel_lock =
@@ -283,6 +297,80 @@ void test_send_to_notification_handler(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+void test_response_builder_commit(void)
+{
+    int status;
+    struct mod_scmi_response_builder response;
+    uint8_t entry = 0xA5;
+    uint32_t *header;
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+
+    fake_response_buffer[2] = UINT32_MAX;
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, FAKE_SERVICE_IDX_OSPM);
+#endif
+    status = response_builder_init(service_id, &response);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR(fake_response_buffer, response.payload);
+    TEST_ASSERT_EQUAL(sizeof(fake_response_buffer), response.capacity);
+
+    header = response_reserve(&response, sizeof(uint32_t));
+    TEST_ASSERT_EQUAL_PTR(&fake_response_buffer[0], header);
+    *header = (uint32_t)SCMI_SUCCESS;
+
+    status = response_write_u32(&response, 0x12345678);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    status = response_write(&response, &entry, sizeof(entry));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(9, response.length);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, FAKE_SERVICE_IDX_OSPM);
+    fwk_module_get_element_name_ExpectAndReturn(service_id, "OSPM");
+#endif
+    mod_scmi_to_transport_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = response_commit(service_id, &response);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0x12345678, fake_response_buffer[1]);
+    /* Stale content in the padding to a whole word is cleared */
+    TEST_ASSERT_EQUAL(0xA5, fake_response_buffer[2]);
+}
+
+void test_response_builder_overflow(void)
+{
+    int status;
+    struct mod_scmi_response_builder response;
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(FAKE_MODULE_ID, FAKE_SERVICE_IDX_OSPM);
+
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, FAKE_SERVICE_IDX_OSPM);
+#endif
+    status = response_builder_init(service_id, &response);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_NOT_NULL(
+        response_reserve(&response, sizeof(fake_response_buffer)));
+    status = response_write_u32(&response, 0);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+    TEST_ASSERT_TRUE(response.overflow);
+
+    /* An overflowed response is replaced with an error status */
+#if !defined(TEST_ON_TARGET)
+    fwk_id_get_element_idx_ExpectAndReturn(service_id, FAKE_SERVICE_IDX_OSPM);
+    fwk_module_get_element_name_ExpectAndReturn(service_id, "OSPM");
+#endif
+    mod_scmi_to_transport_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = response_commit(service_id, &response);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
 int scmi_test_main(void)
 {
     UNITY_BEGIN();
@@ -292,6 +380,9 @@ int scmi_test_main(void)
 
     RUN_TEST(test_send_to_message_handler);
     RUN_TEST(test_send_to_notification_handler);
+
+    RUN_TEST(test_response_builder_commit);
+    RUN_TEST(test_response_builder_overflow);
     return UNITY_END();
 }
 
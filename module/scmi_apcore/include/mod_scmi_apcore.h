@@ -86,6 +86,50 @@ struct mod_scmi_apcore_config {
     enum mod_scmi_apcore_register_width reset_register_width;
 };
 
+/*!
+ * \brief Module API indices.
+ */
+enum mod_scmi_apcore_api_idx {
+    /*! Interface for the SCMI module */
+    MOD_SCMI_APCORE_API_IDX_SCMI_PROTOCOL,
+
+    /*! Interface for programming the reset address from the firmware */
+    MOD_SCMI_APCORE_API_IDX_RESET_ADDRESS,
+
+    /*! Number of APIs */
+    MOD_SCMI_APCORE_API_IDX_COUNT,
+};
+
+/*!
+ * \brief Reset address API.
+ *
+ * \details Allows other modules to program the reset address of the CPUs
+ *      without going through the SCMI protocol, for instance when a single
+ *      cluster is brought back up.
+ */
+struct mod_scmi_apcore_reset_address_api {
+    /*!
+     * \brief Program the reset address of the registers of a single group.
+     *
+     * \details Reset register groups typically match the clusters of the
+     *      platform. The registers are written even when they are expected to
+     *      hold the requested address, as they may have been reset since.
+     *
+     * \param group_idx Index of the group in
+     *      ::mod_scmi_apcore_config::reset_register_group_table.
+     * \param reset_address Reset address.
+     *
+     * \retval ::FWK_SUCCESS The reset address was programmed.
+     * \retval ::FWK_E_PARAM The group index is invalid, the address is not
+     *      aligned or does not fit in the reset registers.
+     * \retval ::FWK_E_ACCESS The configuration has been locked by an agent.
+     * \return One of the standard framework error codes.
+     */
+    int (*set_group_reset_address)(
+        unsigned int group_idx,
+        uint64_t reset_address);
+};
+
 /*!
  * \}
  */
@@ -28,6 +28,14 @@ struct scmi_apcore_ctx {
     /* Module Configuration */
     const struct mod_scmi_apcore_config *config;
 
+    /*
+     * Function programming the registers of a group, selected at
+     * initialization time according to the width of the reset registers.
+     */
+    void (*write_group)(
+        const struct mod_scmi_apcore_reset_register_group *reg_group,
+        uint64_t reset_address);
+
     /* SCMI module API */
     const struct mod_scmi_from_protocol_api *scmi_api;
 
@@ -77,13 +85,56 @@ static const unsigned int payload_size_table[] = {
 /*
  * Static, Helper Functions
  */
+static void write_group_32(
+    const struct mod_scmi_apcore_reset_register_group *reg_group,
+    uint64_t reset_address)
+{
+    volatile uint32_t *reset_reg;
+    uint32_t address_low;
+    size_t reg_idx;
+
+    reset_reg = (volatile uint32_t *)reg_group->base_register;
+    address_low = (uint32_t)reset_address;
+
+    for (reg_idx = 0; reg_idx < reg_group->register_count; reg_idx++) {
+        reset_reg[reg_idx] = address_low;
+    }
+}
+
+static void write_group_64(
+    const struct mod_scmi_apcore_reset_register_group *reg_group,
+    uint64_t reset_address)
+{
+    volatile uint64_t *reset_reg;
+    size_t reg_idx;
+
+    reset_reg = (volatile uint64_t *)reg_group->base_register;
+
+    for (reg_idx = 0; reg_idx < reg_group->register_count; reg_idx++) {
+        reset_reg[reg_idx] = reset_address;
+    }
+}
+
+static void set_group_reset_address(
+    unsigned int grp_idx,
+    uint64_t reset_address)
+{
+    const struct mod_scmi_apcore_reset_register_group *reg_group;
+
+    /*
+     * The registers are always written, as they may have been reset along
+     * with the cores since they were last programmed.
+     */
+    reg_group = &scmi_apcore_ctx.config->reset_register_group_table[grp_idx];
+    fwk_assert(reg_group->base_register != 0);
+
+    scmi_apcore_ctx.write_group(reg_group, reset_address);
+}
+
 static int set_reset_address(uint32_t address_low, uint32_t address_high)
 {
     uint64_t address_composite;
     unsigned int grp_idx;
-    unsigned int reg_idx;
-    const struct mod_scmi_apcore_reset_register_group *reg_group;
-    uintptr_t reset_reg;
 
     address_composite = ((uint64_t)address_high << 32) | address_low;
 
@@ -91,27 +142,7 @@ static int set_reset_address(uint32_t address_low, uint32_t address_high)
     for (grp_idx = 0;
          grp_idx < scmi_apcore_ctx.config->reset_register_group_count;
          grp_idx++) {
-
-        reg_group =
-            &scmi_apcore_ctx.config->reset_register_group_table[grp_idx];
-        fwk_assert(reg_group->base_register != 0);
-
-        /* Begin with the first register in the group */
-        reset_reg = reg_group->base_register;
-
-        /* Program each reset vector register within the group */
-        for (reg_idx = 0; reg_idx < reg_group->register_count; reg_idx++) {
-            if (scmi_apcore_ctx.config->reset_register_width ==
-                MOD_SCMI_APCORE_REG_WIDTH_32) {
-                /* Treat the register as 32-bit */
-                *(uint32_t *)reset_reg = address_low;
-                reset_reg += sizeof(uint32_t);
-            } else {
-                /* Treat the register as 64-bit */
-                *(uint64_t *)reset_reg = address_composite;
-                reset_reg += sizeof(uint64_t);
-            }
-        }
+        set_group_reset_address(grp_idx, address_composite);
     }
 
     return FWK_SUCCESS;
@@ -364,6 +395,41 @@ static struct mod_scmi_to_protocol_api scmi_apcore_mod_scmi_to_protocol_api = {
     .message_handler = scmi_apcore_message_handler
 };
 
+/*
+ * Reset address API
+ */
+static int scmi_apcore_set_group_reset_address(
+    unsigned int group_idx,
+    uint64_t reset_address)
+{
+    if (group_idx >= scmi_apcore_ctx.config->reset_register_group_count) {
+        return FWK_E_PARAM;
+    }
+
+    if ((reset_address % 4) != 0) {
+        return FWK_E_PARAM;
+    }
+
+    if (((reset_address >> 32) != 0) &&
+        (scmi_apcore_ctx.config->reset_register_width ==
+         MOD_SCMI_APCORE_REG_WIDTH_32)) {
+        return FWK_E_PARAM;
+    }
+
+    if (scmi_apcore_ctx.locked) {
+        return FWK_E_ACCESS;
+    }
+
+    set_group_reset_address(group_idx, reset_address);
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_apcore_reset_address_api
+    scmi_apcore_reset_address_api = {
+        .set_group_reset_address = scmi_apcore_set_group_reset_address,
+    };
+
 /*
  * Framework handlers
  */
@@ -389,6 +455,12 @@ static int scmi_apcore_init(fwk_id_t module_id, unsigned int element_count,
 
     scmi_apcore_ctx.config = config;
 
+    if (config->reset_register_width == MOD_SCMI_APCORE_REG_WIDTH_32) {
+        scmi_apcore_ctx.write_group = write_group_32;
+    } else {
+        scmi_apcore_ctx.write_group = write_group_64;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -407,19 +479,30 @@ static int scmi_apcore_bind(fwk_id_t id, unsigned int round)
 static int scmi_apcore_process_bind_request(fwk_id_t source_id,
     fwk_id_t target_id, fwk_id_t api_id, const void **api)
 {
-    /* Only accept binding requests from the SCMI module. */
-    if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
-        return FWK_E_ACCESS;
-    }
+    switch ((enum mod_scmi_apcore_api_idx)fwk_id_get_api_idx(api_id)) {
+    case MOD_SCMI_APCORE_API_IDX_SCMI_PROTOCOL:
+        /* Only accept binding requests from the SCMI module. */
+        if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+            return FWK_E_ACCESS;
+        }
+
+        *api = &scmi_apcore_mod_scmi_to_protocol_api;
+        break;
 
-    *api = &scmi_apcore_mod_scmi_to_protocol_api;
+    case MOD_SCMI_APCORE_API_IDX_RESET_ADDRESS:
+        *api = &scmi_apcore_reset_address_api;
+        break;
+
+    default:
+        return FWK_E_PARAM;
+    }
 
     return FWK_SUCCESS;
 }
 
 /* SCMI Clock Management Protocol Definition */
 const struct fwk_module module_scmi_apcore = {
-    .api_count = 1,
+    .api_count = (unsigned int)MOD_SCMI_APCORE_API_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_apcore_init,
     .bind = scmi_apcore_bind,
@@ -0,0 +1,337 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+#define FAKE_AGENT_ID 1
+#define FAKE_REGISTER_COUNT 2
+#define FAKE_RESET_ADDRESS_LOW 0x80001000
+#define FAKE_RESET_ADDRESS_HIGH 0x8
+
+enum fake_group_idx {
+    FAKE_GROUP_IDX_0,
+    FAKE_GROUP_IDX_1,
+    FAKE_GROUP_IDX_COUNT,
+};
+
+static uint64_t fake_registers[FAKE_GROUP_IDX_COUNT][FAKE_REGISTER_COUNT];
+
+static const struct mod_scmi_apcore_reset_register_group
+    fake_group_table[FAKE_GROUP_IDX_COUNT] = {
+        [FAKE_GROUP_IDX_0] = {
+            .base_register = (uintptr_t)fake_registers[FAKE_GROUP_IDX_0],
+            .register_count = FAKE_REGISTER_COUNT,
+        },
+        [FAKE_GROUP_IDX_1] = {
+            .base_register = (uintptr_t)fake_registers[FAKE_GROUP_IDX_1],
+            .register_count = FAKE_REGISTER_COUNT,
+        },
+    };
+
+static struct mod_scmi_apcore_config fake_config = {
+    .reset_register_group_table = fake_group_table,
+    .reset_register_group_count = FAKE_GROUP_IDX_COUNT,
+};
+
+static enum scmi_agent_type fake_agent_type;
+
+/* Last response sent through the SCMI module */
+static uint32_t response[4];
+static size_t response_size;
+
+static int fake_get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    *agent_id = FAKE_AGENT_ID;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_agent_type(
+    uint32_t agent_id,
+    enum scmi_agent_type *agent_type)
+{
+    TEST_ASSERT_EQUAL(FAKE_AGENT_ID, agent_id);
+    *agent_type = fake_agent_type;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    TEST_ASSERT_TRUE(size <= sizeof(response));
+    memcpy(response, payload, size);
+    response_size = size;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api fake_scmi_api = {
+    .get_agent_id = fake_get_agent_id,
+    .get_agent_type = fake_get_agent_type,
+    .respond = fake_respond,
+};
+
+static void init_module(enum mod_scmi_apcore_register_width width)
+{
+    int status;
+
+    fake_config.reset_register_width = width;
+
+    status = scmi_apcore_init(
+        fwk_module_id_scmi_apcore, 0, (const void *)&fake_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void setUp(void)
+{
+    memset(&scmi_apcore_ctx, 0, sizeof(scmi_apcore_ctx));
+    memset(fake_registers, 0, sizeof(fake_registers));
+    memset(response, 0, sizeof(response));
+    response_size = 0;
+
+    scmi_apcore_ctx.scmi_api = &fake_scmi_api;
+    fake_agent_type = SCMI_AGENT_TYPE_PSCI;
+
+    init_module(MOD_SCMI_APCORE_REG_WIDTH_64);
+}
+
+void tearDown(void)
+{
+}
+
+static int send_reset_address_set(
+    uint32_t address_low,
+    uint32_t address_high,
+    uint32_t attributes)
+{
+    struct scmi_apcore_reset_address_set_a2p payload = {
+        .reset_address_low = address_low,
+        .reset_address_high = address_high,
+        .attributes = attributes,
+    };
+
+    return scmi_apcore_message_handler(
+        fwk_module_id_scmi_apcore,
+        fwk_module_id_scmi,
+        (const uint32_t *)&payload,
+        sizeof(payload),
+        MOD_SCMI_APCORE_RESET_ADDRESS_SET);
+}
+
+static void assert_registers_equal(uint64_t expected)
+{
+    unsigned int grp_idx, reg_idx;
+
+    for (grp_idx = 0; grp_idx < FAKE_GROUP_IDX_COUNT; grp_idx++) {
+        for (reg_idx = 0; reg_idx < FAKE_REGISTER_COUNT; reg_idx++) {
+            TEST_ASSERT_EQUAL_UINT64(
+                expected, fake_registers[grp_idx][reg_idx]);
+        }
+    }
+}
+
+void test_scmi_apcore_reset_address_set_64(void)
+{
+    int status;
+    uint64_t expected;
+
+    expected =
+        ((uint64_t)FAKE_RESET_ADDRESS_HIGH << 32) | FAKE_RESET_ADDRESS_LOW;
+
+    status = send_reset_address_set(
+        FAKE_RESET_ADDRESS_LOW, FAKE_RESET_ADDRESS_HIGH, 0);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    assert_registers_equal(expected);
+}
+
+void test_scmi_apcore_reset_address_set_32(void)
+{
+    int status;
+    unsigned int grp_idx;
+    uint32_t *reset_reg;
+
+    init_module(MOD_SCMI_APCORE_REG_WIDTH_32);
+
+    status = send_reset_address_set(FAKE_RESET_ADDRESS_LOW, 0, 0);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+
+    for (grp_idx = 0; grp_idx < FAKE_GROUP_IDX_COUNT; grp_idx++) {
+        reset_reg = (uint32_t *)fake_registers[grp_idx];
+        TEST_ASSERT_EQUAL_UINT32(FAKE_RESET_ADDRESS_LOW, reset_reg[0]);
+        TEST_ASSERT_EQUAL_UINT32(FAKE_RESET_ADDRESS_LOW, reset_reg[1]);
+        /* Only the 32-bit registers of the group are written */
+        TEST_ASSERT_EQUAL_UINT32(0, reset_reg[2]);
+    }
+}
+
+/*
+ * The registers are reset along with the cores, the same address is requested
+ * again and must be written back.
+ */
+void test_scmi_apcore_reset_address_set_after_register_reset(void)
+{
+    int status;
+
+    status = send_reset_address_set(FAKE_RESET_ADDRESS_LOW, 0, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    assert_registers_equal(FAKE_RESET_ADDRESS_LOW);
+
+    memset(fake_registers, 0, sizeof(fake_registers));
+
+    status = send_reset_address_set(FAKE_RESET_ADDRESS_LOW, 0, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    assert_registers_equal(FAKE_RESET_ADDRESS_LOW);
+}
+
+void test_scmi_apcore_reset_address_set_not_psci(void)
+{
+    int status;
+
+    fake_agent_type = SCMI_AGENT_TYPE_OSPM;
+
+    status = send_reset_address_set(FAKE_RESET_ADDRESS_LOW, 0, 0);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_DENIED, (int32_t)response[0]);
+    assert_registers_equal(0);
+}
+
+void test_scmi_apcore_reset_address_set_high_on_32(void)
+{
+    int status;
+
+    init_module(MOD_SCMI_APCORE_REG_WIDTH_32);
+
+    status = send_reset_address_set(
+        FAKE_RESET_ADDRESS_LOW, FAKE_RESET_ADDRESS_HIGH, 0);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, (int32_t)response[0]);
+    assert_registers_equal(0);
+}
+
+void test_scmi_apcore_reset_address_set_lock(void)
+{
+    int status;
+
+    status = send_reset_address_set(
+        FAKE_RESET_ADDRESS_LOW, 0, MOD_SCMI_APCORE_RESET_ADDRESS_SET_LOCK_MASK);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+
+    memset(fake_registers, 0, sizeof(fake_registers));
+
+    status = send_reset_address_set(FAKE_RESET_ADDRESS_LOW, 0, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_DENIED, (int32_t)response[0]);
+    assert_registers_equal(0);
+}
+
+void test_scmi_apcore_reset_address_get(void)
+{
+    int status;
+    struct scmi_apcore_reset_address_get_p2a *return_values;
+    uint64_t reset_address;
+    uint32_t payload = 0;
+
+    reset_address =
+        ((uint64_t)FAKE_RESET_ADDRESS_HIGH << 32) | FAKE_RESET_ADDRESS_LOW;
+    fake_registers[FAKE_GROUP_IDX_0][0] = reset_address;
+
+    status = scmi_apcore_message_handler(
+        fwk_module_id_scmi_apcore,
+        fwk_module_id_scmi,
+        &payload,
+        0,
+        MOD_SCMI_APCORE_RESET_ADDRESS_GET);
+
+    return_values = (struct scmi_apcore_reset_address_get_p2a *)response;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL_UINT32(
+        FAKE_RESET_ADDRESS_LOW, return_values->reset_address_low);
+    TEST_ASSERT_EQUAL_UINT32(
+        FAKE_RESET_ADDRESS_HIGH, return_values->reset_address_high);
+}
+
+void test_scmi_apcore_set_group_reset_address(void)
+{
+    int status;
+
+    status = scmi_apcore_set_group_reset_address(
+        FAKE_GROUP_IDX_1, FAKE_RESET_ADDRESS_LOW);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT64(0, fake_registers[FAKE_GROUP_IDX_0][0]);
+    TEST_ASSERT_EQUAL_UINT64(0, fake_registers[FAKE_GROUP_IDX_0][1]);
+    TEST_ASSERT_EQUAL_UINT64(
+        FAKE_RESET_ADDRESS_LOW, fake_registers[FAKE_GROUP_IDX_1][0]);
+    TEST_ASSERT_EQUAL_UINT64(
+        FAKE_RESET_ADDRESS_LOW, fake_registers[FAKE_GROUP_IDX_1][1]);
+}
+
+void test_scmi_apcore_set_group_reset_address_invalid(void)
+{
+    int status;
+
+    status = scmi_apcore_set_group_reset_address(
+        FAKE_GROUP_IDX_COUNT, FAKE_RESET_ADDRESS_LOW);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = scmi_apcore_set_group_reset_address(
+        FAKE_GROUP_IDX_0, FAKE_RESET_ADDRESS_LOW + 2);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    scmi_apcore_ctx.locked = true;
+
+    status = scmi_apcore_set_group_reset_address(
+        FAKE_GROUP_IDX_0, FAKE_RESET_ADDRESS_LOW);
+    TEST_ASSERT_EQUAL(FWK_E_ACCESS, status);
+
+    assert_registers_equal(0);
+}
+
+int scmi_apcore_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scmi_apcore_reset_address_set_64);
+    RUN_TEST(test_scmi_apcore_reset_address_set_32);
+    RUN_TEST(test_scmi_apcore_reset_address_set_after_register_reset);
+    RUN_TEST(test_scmi_apcore_reset_address_set_not_psci);
+    RUN_TEST(test_scmi_apcore_reset_address_set_high_on_32);
+    RUN_TEST(test_scmi_apcore_reset_address_set_lock);
+    RUN_TEST(test_scmi_apcore_reset_address_get);
+    RUN_TEST(test_scmi_apcore_set_group_reset_address);
+    RUN_TEST(test_scmi_apcore_set_group_reset_address_invalid);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_apcore_test_main();
+}
+#endif
@@ -48,10 +48,16 @@ enum scmi_perf_event_idx {
 
 struct perf_operations {
     /*
-     * Service identifier currently requesting operation.
-     * A 'none' value means that there is no pending request.
+     * Service identifiers of the agents waiting for the current level of the
+     * domain. All of them are answered from the same DVFS result.
      */
-    fwk_id_t service_id;
+    fwk_id_t *waiting_service_ids;
+
+    /*
+     * Number of agents waiting for the current level.
+     * A zero value means that there is no pending request.
+     */
+    unsigned int waiting_count;
 };
 
 struct perf_opp_table {
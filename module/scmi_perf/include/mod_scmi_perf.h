@@ -103,6 +103,50 @@ struct scmi_perf_fch_config {
     fwk_id_t transport_api_id;
 };
 
+/*!
+ * \brief Compact fast channel region header.
+ *
+ * \details In the compact layout the level set and limit set fast channels of
+ *      all the performance domains are packed in a single shared region made
+ *      of:
+ *      - this header,
+ *      - one level per performance domain,
+ *      - one ::mod_scmi_perf_fast_channel_limit per performance domain.
+ *
+ *      The entries of the domains not using the compact layout are unused.
+ *      An agent increments the sequence word of a group after updating any
+ *      of its entries. A poll finding the sequence word of a group unchanged
+ *      skips the entries of the group.
+ */
+struct mod_scmi_perf_fch_compact_header {
+    /*! Change sequence of the level set group */
+    uint32_t level_set_sequence;
+
+    /*! Change sequence of the limit set group */
+    uint32_t limit_set_sequence;
+};
+
+/*!
+ * \brief Size in bytes of a compact fast channel region.
+ *
+ * \param DOMAIN_COUNT Number of performance domains.
+ */
+#define MOD_SCMI_PERF_FCH_COMPACT_SIZE(DOMAIN_COUNT) \
+    (sizeof(struct mod_scmi_perf_fch_compact_header) + \
+     ((DOMAIN_COUNT) * \
+      (sizeof(uint32_t) + sizeof(struct mod_scmi_perf_fast_channel_limit))))
+
+/*!
+ * \brief Compact fast channel layout configuration.
+ */
+struct mod_scmi_perf_fch_compact_config {
+    /*! Address of the region as seen by the firmware */
+    uintptr_t local_view_address;
+
+    /*! Address of the region as seen by the agents */
+    uintptr_t target_view_address;
+};
+
 #endif
 /*!
  * \brief Performance domain configuration data.
@@ -114,6 +158,17 @@ struct mod_scmi_perf_domain_config {
 
     /*! Flag indicates whether a particular domain supports fast channel */
     bool supports_fast_channels;
+
+    /*!
+     * \brief Flag indicating that the domain uses the compact fast channel
+     *      layout.
+     *
+     * \details The level set and limit set fast channels of the domain are
+     *      then entries of the compact region rather than transport channels,
+     *      and a poll skips them while the sequence word of their group is
+     *      unchanged. Requires ::mod_scmi_perf_config::fch_compact_config.
+     */
+    bool fch_compact;
 #endif
 
     /*! Flag indicating that statistics are collected for this domain */
@@ -191,6 +246,21 @@ struct mod_scmi_perf_config {
     /*! Fast Channel polling rate */
     uint32_t fast_channels_rate_limit;
 
+#ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
+    /*!
+     * \brief Compact fast channel layout.
+     *
+     * \details When provided, the level set and limit set fast channels of
+     *      the domains with ::mod_scmi_perf_domain_config::fch_compact set
+     *      are served from the compact region described by
+     *      ::mod_scmi_perf_fch_compact_header rather than from the transport.
+     *      The level get and limit get fast channels are unaffected.
+     *
+     * \note Agents must maintain the sequence words of the region.
+     */
+    const struct mod_scmi_perf_fch_compact_config *fch_compact_config;
+#endif
+
     /*! Flag indicating statistics in use */
     bool stats_enabled;
 
@@ -22,6 +22,7 @@
 #    include <mod_transport.h>
 #endif
 
+#include <fwk_attributes.h>
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
@@ -49,6 +50,16 @@ struct mod_scmi_perf_fc_ctx {
      * fast channel driver.
      */
     bool callback_registered;
+
+    /* Header of the compact fast channel region, NULL when not in use */
+    volatile struct mod_scmi_perf_fch_compact_header *compact_header;
+
+    /* Sequence words of the compact region seen at the last poll */
+    uint32_t level_set_sequence;
+    uint32_t limit_set_sequence;
+
+    /* Every domain with fast channels uses the compact layout */
+    bool compact_only;
 #endif
 };
 
@@ -63,7 +74,7 @@ static unsigned int fast_channel_elem_size[MOD_SCMI_PERF_FAST_CHANNEL_COUNT] = {
 
 static struct mod_scmi_perf_fc_ctx perf_fch_ctx;
 
-static void fast_channel_callback(uintptr_t param);
+static FWK_HOT void fast_channel_callback(uintptr_t param);
 
 /*
  * Static Helpers
@@ -120,6 +131,128 @@ void perf_fch_set_fch_get_level(uint32_t domain_idx, uint32_t level)
     }
 }
 
+/*
+ * In the compact layout, the level set and limit set fast channels of a domain
+ * are an entry of the dense arrays following the region header.
+ */
+static bool fch_is_compact(unsigned int domain_idx, unsigned int fch_idx)
+{
+    return (perf_fch_ctx.perf_ctx->config->fch_compact_config != NULL) &&
+        (*perf_fch_ctx.perf_ctx->config->domains)[domain_idx].fch_compact &&
+        ((fch_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET) ||
+         (fch_idx == MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET));
+}
+
+static void fch_compact_address_init(
+    unsigned int domain_idx,
+    unsigned int fch_idx,
+    struct mod_transport_fast_channel_addr *fch_address)
+{
+    const struct mod_scmi_perf_fch_compact_config *compact_config =
+        perf_fch_ctx.perf_ctx->config->fch_compact_config;
+    size_t domain_count = perf_fch_ctx.perf_ctx->config->perf_doms_count;
+    uintptr_t offset;
+
+    offset = sizeof(struct mod_scmi_perf_fch_compact_header);
+    if (fch_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET) {
+        offset += domain_idx * sizeof(uint32_t);
+    } else {
+        offset += (domain_count * sizeof(uint32_t)) +
+            (domain_idx * sizeof(struct mod_scmi_perf_fast_channel_limit));
+    }
+
+    *fch_address = (struct mod_transport_fast_channel_addr){
+        .local_view_address = compact_config->local_view_address + offset,
+        .target_view_address = compact_config->target_view_address + offset,
+        .length = fast_channel_elem_size[fch_idx],
+    };
+}
+
+/* The domains using the compact layout need the compact region */
+static int fch_compact_check_config(const struct mod_scmi_perf_config *config)
+{
+    unsigned int domain_idx;
+
+    if (config->fch_compact_config != NULL) {
+        return FWK_SUCCESS;
+    }
+
+    for (domain_idx = 0; domain_idx < config->perf_doms_count; domain_idx++) {
+        if ((*config->domains)[domain_idx].fch_compact) {
+            return FWK_E_DATA;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Check whether an agent updated a group of the compact region since the last
+ * poll.
+ */
+static bool fch_compact_group_changed(
+    volatile const uint32_t *sequence,
+    uint32_t *last_sequence)
+{
+    uint32_t current_sequence = *sequence;
+
+    if (current_sequence == *last_sequence) {
+        return false;
+    }
+
+    *last_sequence = current_sequence;
+
+    return true;
+}
+
+/*
+ * Read the sequence words of the compact region. Returns false when there is
+ * nothing to process: no group changed and no domain uses transport channels.
+ */
+static bool fch_compact_poll(bool *level_set_changed, bool *limit_set_changed)
+{
+    *level_set_changed = true;
+    *limit_set_changed = true;
+
+    if (perf_fch_ctx.compact_header == NULL) {
+        return true;
+    }
+
+    *level_set_changed = fch_compact_group_changed(
+        &perf_fch_ctx.compact_header->level_set_sequence,
+        &perf_fch_ctx.level_set_sequence);
+    *limit_set_changed = fch_compact_group_changed(
+        &perf_fch_ctx.compact_header->limit_set_sequence,
+        &perf_fch_ctx.limit_set_sequence);
+
+    return *level_set_changed || *limit_set_changed ||
+        !perf_fch_ctx.compact_only;
+}
+
+/*
+ * Get the level set and limit set fast channels of a domain to process. A
+ * compact channel whose group did not change is left out.
+ */
+static void get_fc_set_addrs(
+    uint32_t domain_idx,
+    bool level_set_changed,
+    bool limit_set_changed,
+    uint32_t **set_level,
+    struct mod_scmi_perf_fast_channel_limit **set_limit)
+{
+    *set_level = NULL;
+    if (level_set_changed ||
+        !fch_is_compact(domain_idx, MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET)) {
+        *set_level = get_fc_set_level_addr(domain_idx);
+    }
+
+    *set_limit = NULL;
+    if (limit_set_changed ||
+        !fch_is_compact(domain_idx, MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET)) {
+        *set_limit = get_fc_set_limit_addr(domain_idx);
+    }
+}
+
 static const struct scmi_perf_fch_config *get_fch_config(
     unsigned int domain_idx,
     unsigned int fch_idx)
@@ -467,7 +600,7 @@ static void perf_eval_performance(
 /*
  * Fast Channel Polling
  */
-static void fast_channel_callback(uintptr_t param)
+static FWK_HOT void fast_channel_callback(uintptr_t param)
 {
     int status;
 
@@ -523,11 +656,23 @@ static void perf_fch_process_plugins_handler(void)
 
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
     struct fc_perf_update update;
+    bool level_set_changed;
+    bool limit_set_changed;
+
+    /*
+     * The plugins are updated on every poll, the domains whose compact
+     * channels did not change report their current level and limits.
+     */
+    (void)fch_compact_poll(&level_set_changed, &limit_set_changed);
 
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
+            get_fc_set_addrs(
+                i,
+                level_set_changed,
+                limit_set_changed,
+                &set_level,
+                &set_limit);
 
             domain_ctx = &perf_ctx->domain_ctx_table[i];
             load_tlimits(set_limit, &tmax, &tmin, domain_ctx);
@@ -547,8 +692,12 @@ static void perf_fch_process_plugins_handler(void)
 
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
+            get_fc_set_addrs(
+                i,
+                level_set_changed,
+                limit_set_changed,
+                &set_level,
+                &set_limit);
 
             domain_ctx = &perf_ctx->domain_ctx_table[i];
 
@@ -600,11 +749,23 @@ static void perf_fch_process(void)
     int status;
 
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
+    bool level_set_changed;
+    bool limit_set_changed;
+
+    /* Nothing to scan when no agent updated the channels */
+    if (!fch_compact_poll(&level_set_changed, &limit_set_changed)) {
+        decrement_pending_req_count();
+        return;
+    }
 
     for (i = 0; i < perf_ctx->domain_count; i++) {
         if (perf_fch_domain_has_fastchannels(i)) {
-            set_limit = get_fc_set_limit_addr(i);
-            set_level = get_fc_set_level_addr(i);
+            get_fc_set_addrs(
+                i,
+                level_set_changed,
+                limit_set_changed,
+                &set_level,
+                &set_limit);
 
             domain_ctx = &perf_ctx->domain_ctx_table[i];
 
@@ -654,7 +815,11 @@ int perf_fch_init(
     perf_fch_ctx.perf_ctx = mod_ctx;
     perf_fch_ctx.api_fch_stub = api;
 
+#ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
+    return fch_compact_check_config(mod_ctx->config);
+#else
     return FWK_SUCCESS;
+#endif
 }
 
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
@@ -670,6 +835,11 @@ int perf_fch_bind(fwk_id_t id, unsigned int round)
         unsigned int fch_idx;
         for (fch_idx = 0; fch_idx < MOD_SCMI_PERF_FAST_CHANNEL_COUNT;
              fch_idx++) {
+            /* Compact fast channels are not provided by the transport */
+            if (fch_is_compact(domain_idx, fch_idx)) {
+                continue;
+            }
+
             fch_config = get_fch_config(domain_idx, fch_idx);
             fch_ctx = get_fch_ctx(domain_idx, fch_idx);
             status = fwk_module_bind(
@@ -698,6 +868,12 @@ static void *get_fch_local_address(
     fch_config = get_fch_config(domain_idx, fch_idx);
     fch_ctx = get_fch_ctx(domain_idx, fch_idx);
 
+    if (fch_is_compact(domain_idx, fch_idx)) {
+        fch_compact_address_init(domain_idx, fch_idx, &fch_ctx->fch_address);
+
+        return (void *)fch_ctx->fch_address.local_view_address;
+    }
+
     status = fch_context_init(fch_config, fch_ctx);
 
     if (status != FWK_SUCCESS) {
@@ -782,8 +958,44 @@ static void initialize_fch_channels(void)
 }
 #endif
 
+#ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
+static void initialize_fch_compact_region(void)
+{
+    const struct mod_scmi_perf_fch_compact_config *compact_config =
+        perf_fch_ctx.perf_ctx->config->fch_compact_config;
+    unsigned int domain_idx;
+
+    if (compact_config == NULL) {
+        return;
+    }
+
+    perf_fch_ctx.compact_only = true;
+    for (domain_idx = 0; domain_idx < perf_fch_ctx.perf_ctx->domain_count;
+         domain_idx++) {
+        if (perf_fch_domain_has_fastchannels(domain_idx) &&
+            !fch_is_compact(domain_idx, MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET)) {
+            perf_fch_ctx.compact_only = false;
+        }
+    }
+
+    perf_fch_ctx.compact_header =
+        (struct mod_scmi_perf_fch_compact_header *)
+            compact_config->local_view_address;
+
+    /* The entries are cleared along with the other fast channels */
+    perf_fch_ctx.compact_header->level_set_sequence = 0;
+    perf_fch_ctx.compact_header->limit_set_sequence = 0;
+    perf_fch_ctx.level_set_sequence = 0;
+    perf_fch_ctx.limit_set_sequence = 0;
+}
+#endif
+
 int perf_fch_start(fwk_id_t id)
 {
+#ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
+    initialize_fch_compact_region();
+#endif
+
 #ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
     return initialize_fch_channels_plugins_handler();
 #else
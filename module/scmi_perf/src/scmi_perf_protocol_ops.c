@@ -140,6 +140,9 @@ static struct scmi_perf_protocol_ctx {
     /* Pointer to a table of operations */
     struct perf_operations *perf_ops_table;
 
+    /* Maximum number of agents waiting for the level of a domain */
+    unsigned int level_get_queue_depth;
+
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     /* Number of active agents */
     unsigned int agent_count;
@@ -420,52 +423,54 @@ static int scmi_perf_describe_levels_handler(
     const uint32_t *payload)
 {
     int status, respond_status;
-    size_t max_payload_size;
     const struct scmi_perf_describe_levels_a2p *parameters;
     fwk_id_t domain_id;
-    struct scmi_perf_level perf_level;
-    unsigned int num_levels, level_index, level_index_max;
-    size_t payload_size;
+    struct mod_scmi_response_builder response;
+    struct scmi_perf_describe_levels_p2a *response_header;
+    struct scmi_perf_level *perf_levels;
+    unsigned int num_levels, level_index, i;
     size_t opp_count;
-    struct mod_dvfs_opp opp;
+    const struct mod_dvfs_opp *opps, *opp;
     uint16_t latency;
     struct scmi_perf_describe_levels_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR,
     };
     struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
 
-    payload_size = sizeof(return_values);
+    parameters = (const struct scmi_perf_describe_levels_a2p *)payload;
+
+    /* Validate the domain identifier */
+    if (parameters->domain_id >= scmi_perf_ctx->domain_count) {
+        status = FWK_SUCCESS;
+        return_values.status = (int32_t)SCMI_NOT_FOUND;
 
-    status = scmi_perf_ctx->scmi_api->get_max_payload_size(
-        service_id, &max_payload_size);
-    if (status != FWK_SUCCESS) {
         goto exit;
     }
 
-    status =
-        (SCMI_PERF_LEVELS_MAX(max_payload_size) > 0) ? FWK_SUCCESS : FWK_E_SIZE;
+    domain_id = get_dependency_id(parameters->domain_id);
+    level_index = parameters->level_index;
+
+    /* The levels are serialized directly in the outbound payload area */
+    status = scmi_perf_ctx->scmi_api->response_builder_init(
+        service_id, &response);
     if (status != FWK_SUCCESS) {
         goto exit;
     }
 
-    parameters = (const struct scmi_perf_describe_levels_a2p *)payload;
-
-    /* Validate the domain identifier */
-    if (parameters->domain_id >= scmi_perf_ctx->domain_count) {
-        return_values.status = (int32_t)SCMI_NOT_FOUND;
-
+    status = (SCMI_PERF_LEVELS_MAX(response.capacity) > 0) ? FWK_SUCCESS :
+                                                             FWK_E_SIZE;
+    if (status != FWK_SUCCESS) {
         goto exit;
     }
 
-    /* Get the number of operating points for the domain */
-    domain_id = get_dependency_id(parameters->domain_id);
-    status = scmi_perf_ctx->dvfs_api->get_opp_count(domain_id, &opp_count);
+    /* Get the operating points of the domain */
+    status = scmi_perf_ctx->dvfs_api->get_opp_table(
+        domain_id, &opps, &opp_count, &latency);
     if (status != FWK_SUCCESS) {
         goto exit;
     }
 
     /* Validate level index */
-    level_index = parameters->level_index;
     if (level_index >= opp_count) {
         return_values.status = (int32_t)SCMI_INVALID_PARAMETERS;
 
@@ -473,58 +478,42 @@ static int scmi_perf_describe_levels_handler(
     }
 
     /* Identify the maximum number of performance levels we can send at once */
-    if (SCMI_PERF_LEVELS_MAX(max_payload_size) < (opp_count - level_index)) {
-        num_levels = (unsigned int)SCMI_PERF_LEVELS_MAX(max_payload_size);
+    if (SCMI_PERF_LEVELS_MAX(response.capacity) < (opp_count - level_index)) {
+        num_levels = (unsigned int)SCMI_PERF_LEVELS_MAX(response.capacity);
     } else {
         num_levels = (unsigned int)(opp_count - level_index);
     }
 
-    level_index_max = (level_index + num_levels - 1);
+    response_header = scmi_perf_ctx->scmi_api->response_reserve(
+        &response, sizeof(*response_header));
+    perf_levels = scmi_perf_ctx->scmi_api->response_reserve(
+        &response, num_levels * sizeof(perf_levels[0]));
+    if ((response_header == NULL) || (perf_levels == NULL)) {
+        status = FWK_E_SIZE;
 
-    status = scmi_perf_ctx->dvfs_api->get_latency(domain_id, &latency);
-    if (status != FWK_SUCCESS) {
         goto exit;
     }
 
     /* Copy DVFS data into returned data structure */
-    for (; level_index <= level_index_max;
-         level_index++, payload_size += sizeof(perf_level)) {
-        status =
-            scmi_perf_ctx->dvfs_api->get_nth_opp(domain_id, level_index, &opp);
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-
-        if (opp.power != 0) {
-            perf_level.power_cost = opp.power;
-        } else {
-            perf_level.power_cost = opp.voltage;
-        }
-        perf_level.performance_level = opp.level;
-        perf_level.attributes = latency;
+    for (i = 0; i < num_levels; i++) {
+        opp = &opps[level_index + i];
 
-        status = scmi_perf_ctx->scmi_api->write_payload(
-            service_id, payload_size, &perf_level, sizeof(perf_level));
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
+        perf_levels[i] = (struct scmi_perf_level){
+            .performance_level = opp->level,
+            .power_cost = (opp->power != 0) ? opp->power : opp->voltage,
+            .attributes = latency,
+        };
     }
 
-    return_values = (struct scmi_perf_describe_levels_p2a){
-        .status = SCMI_SUCCESS,
-        .num_levels =
-            SCMI_PERF_NUM_LEVELS(num_levels, (opp_count - level_index_max - 1))
-    };
+    response_header->status = (int32_t)SCMI_SUCCESS;
+    response_header->num_levels = SCMI_PERF_NUM_LEVELS(
+        num_levels, (opp_count - level_index - num_levels));
 
-    status = scmi_perf_ctx->scmi_api->write_payload(
-        service_id, 0, &return_values, sizeof(return_values));
+    return scmi_perf_ctx->scmi_api->response_commit(service_id, &response);
 
 exit:
     respond_status = scmi_perf_ctx->scmi_api->respond(
-        service_id,
-        (return_values.status == SCMI_SUCCESS) ? NULL : &return_values.status,
-        (return_values.status == SCMI_SUCCESS) ? payload_size :
-                                                 sizeof(return_values.status));
+        service_id, &return_values.status, sizeof(return_values.status));
     if (respond_status != FWK_SUCCESS) {
         FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
     }
@@ -718,9 +707,12 @@ static int scmi_perf_level_get_handler(
     const uint32_t *payload)
 {
     int status, respond_status;
+    unsigned int dep_dom_idx;
+    uint32_t curr_level;
     const struct scmi_perf_level_get_a2p *parameters;
     struct scmi_perf_event_parameters *evt_params;
     struct scmi_perf_level_get_p2a return_values;
+    struct perf_operations *perf_ops;
     struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
 
     parameters = (const struct scmi_perf_level_get_a2p *)payload;
@@ -731,13 +723,43 @@ static int scmi_perf_level_get_handler(
         goto exit;
     }
 
-    /* Check if there is already a request pending for this domain */
-    if (!fwk_id_is_equal(
-            perf_prot_ctx
-                .perf_ops_table[fwk_id_get_element_idx(
-                    get_dependency_id(parameters->domain_id))]
-                .service_id,
-            FWK_ID_NONE)) {
+    dep_dom_idx =
+        fwk_id_get_element_idx(get_dependency_id(parameters->domain_id));
+    perf_ops = &perf_prot_ctx.perf_ops_table[dep_dom_idx];
+
+    if (perf_ops->waiting_count != 0) {
+        /*
+         * A request is already pending for this domain, the agent is
+         * answered along with the others when the DVFS result is available.
+         */
+        if (perf_ops->waiting_count >= perf_prot_ctx.level_get_queue_depth) {
+            return_values.status = (int32_t)SCMI_BUSY;
+            status = FWK_SUCCESS;
+
+            goto exit;
+        }
+
+        perf_ops->waiting_service_ids[perf_ops->waiting_count++] = service_id;
+
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * The level is cached once DVFS has reported its current OPP, in which
+     * case there is no need to query DVFS again.
+     */
+    curr_level = scmi_perf_ctx->domain_ctx_table[dep_dom_idx].curr_level;
+    if (curr_level != 0) {
+        return_values = (struct scmi_perf_level_get_p2a){
+            .status = (int32_t)SCMI_SUCCESS,
+            .performance_level = curr_level,
+        };
+        status = FWK_SUCCESS;
+
+        goto exit;
+    }
+
+    if (perf_prot_ctx.level_get_queue_depth == 0) {
         return_values.status = (int32_t)SCMI_BUSY;
         status = FWK_SUCCESS;
 
@@ -761,8 +783,8 @@ static int scmi_perf_level_get_handler(
     }
 
     /* Store service identifier to indicate there is a pending request */
-    perf_prot_ctx.perf_ops_table[fwk_id_get_element_idx(evt_params->domain_id)]
-        .service_id = service_id;
+    perf_ops->waiting_service_ids[0] = service_id;
+    perf_ops->waiting_count = 1;
 
     return FWK_SUCCESS;
 
@@ -1027,27 +1049,29 @@ static struct mod_scmi_to_protocol_api scmi_perf_mod_scmi_to_protocol_api = {
 static void scmi_perf_respond(void *return_values, fwk_id_t domain_id, int size)
 {
     struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
-    int idx = (int)fwk_id_get_element_idx(domain_id);
-    fwk_id_t service_id;
+    struct perf_operations *perf_ops;
+    unsigned int i, waiting_count;
     int respond_status;
 
+    perf_ops = &perf_prot_ctx.perf_ops_table[fwk_id_get_element_idx(domain_id)];
+
     /*
-     * The service identifier used for the response is retrieved from the
-     * domain operations table.
+     * The service identifiers used for the response are retrieved from the
+     * domain operations table. Every agent waiting on the domain receives
+     * the same result.
      */
-    service_id = perf_prot_ctx.perf_ops_table[idx].service_id;
+    waiting_count = perf_ops->waiting_count;
 
-    respond_status =
-        scmi_perf_ctx->scmi_api->respond(service_id, return_values, size);
-    if (respond_status != FWK_SUCCESS) {
-        FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
-    }
+    /* Indicate the domain is available again */
+    perf_ops->waiting_count = 0;
 
-    /*
-     * Set the service identifier to 'none' to indicate the domain is
-     * available again.
-     */
-    perf_prot_ctx.perf_ops_table[idx].service_id = FWK_ID_NONE;
+    for (i = 0; i < waiting_count; i++) {
+        respond_status = scmi_perf_ctx->scmi_api->respond(
+            perf_ops->waiting_service_ids[i], return_values, size);
+        if (respond_status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-PERF] %s @%d", __func__, __LINE__);
+        }
+    }
 }
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
@@ -1211,8 +1235,6 @@ int perf_prot_ops_init(
     struct mod_scmi_perf_ctx *mod_ctx,
     struct mod_scmi_perf_private_api_perf_stub *api)
 {
-    uint32_t i;
-
     perf_prot_ctx.scmi_perf_ctx = mod_ctx;
     perf_prot_ctx.api_stub = api;
 
@@ -1220,11 +1242,6 @@ int perf_prot_ops_init(
         perf_prot_ctx.scmi_perf_ctx->config->perf_doms_count,
         sizeof(struct perf_operations));
 
-    /* Initialize table */
-    for (i = 0; i < perf_prot_ctx.scmi_perf_ctx->domain_count; i++) {
-        perf_prot_ctx.perf_ops_table[i].service_id = FWK_ID_NONE;
-    }
-
     return FWK_SUCCESS;
 }
 
@@ -1267,9 +1284,49 @@ int perf_prot_ops_bind(fwk_id_t id, unsigned int round)
     return status;
 }
 
+/*
+ * An agent has at most one outstanding command on its channel, so no more
+ * than one request per agent can be waiting for the level of a domain.
+ */
+static int scmi_perf_level_get_queue_init(void)
+{
+    int status;
+    unsigned int agent_count;
+    uint32_t i;
+    fwk_id_t *service_ids;
+    struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
+
+    status = scmi_perf_ctx->scmi_api->get_agent_count(&agent_count);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (agent_count == 0) {
+        return FWK_E_DATA;
+    }
+
+    service_ids = fwk_mm_calloc(
+        scmi_perf_ctx->config->perf_doms_count * agent_count,
+        sizeof(fwk_id_t));
+
+    for (i = 0; i < scmi_perf_ctx->config->perf_doms_count; i++) {
+        perf_prot_ctx.perf_ops_table[i].waiting_service_ids =
+            &service_ids[i * agent_count];
+    }
+
+    perf_prot_ctx.level_get_queue_depth = agent_count;
+
+    return FWK_SUCCESS;
+}
+
 int perf_prot_ops_start(fwk_id_t id)
 {
-    int status = FWK_SUCCESS;
+    int status;
+
+    status = scmi_perf_level_get_queue_init();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     status =
@@ -30,6 +30,8 @@
 
 #include <fwk_element.h>
 #include <fwk_macros.h>
+
+#include <string.h>
 #include UNIT_TEST_SRC
 
 static struct mod_scmi_perf_ctx scmi_perf_ctx;
@@ -534,6 +536,163 @@ void utest_perf_fch_init_success(void)
         SCMI_PERF_FC_MIN_RATE_LIMIT, perf_fch_ctx.fast_channels_rate_limit);
 }
 
+static unsigned int perf_set_level_count;
+static unsigned int perf_set_limits_count;
+
+static int perf_set_level_fake(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    uint32_t perf_level)
+{
+    TEST_ASSERT_EQUAL(test_dvfs_config.opps[1].level, perf_level);
+    perf_set_level_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int perf_set_limits_fake(
+    fwk_id_t domain_id,
+    unsigned int agent_id,
+    const struct mod_scmi_perf_level_limits *limits)
+{
+    perf_set_limits_count++;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Test that the compact fast channels are laid out in the shared region and
+ * that a group is only scanned when its sequence word changed.
+ */
+void utest_perf_fch_process_compact(void)
+{
+    uint32_t region
+        [MOD_SCMI_PERF_FCH_COMPACT_SIZE(SCMI_PERF_ELEMENT_IDX_COUNT) /
+         sizeof(uint32_t)] = { 0 };
+    struct mod_scmi_perf_fch_compact_header *header =
+        (struct mod_scmi_perf_fch_compact_header *)region;
+    struct mod_scmi_perf_fch_compact_config compact_config = {
+        .local_view_address = (uintptr_t)region,
+        .target_view_address = SCP_SCMI_FAST_CHANNEL_BASE,
+    };
+    struct mod_scmi_perf_domain_config
+        compact_domains[SCMI_PERF_ELEMENT_IDX_COUNT];
+    struct mod_scmi_perf_config config = perf_config;
+    struct scmi_perf_domain_ctx domain_ctx_table[SCMI_PERF_ELEMENT_IDX_COUNT];
+    struct mod_scmi_perf_private_api_perf_stub api = {
+        .perf_set_level = perf_set_level_fake,
+        .perf_set_limits = perf_set_limits_fake,
+    };
+    const struct fast_channel_ctx *fch_ctx;
+    uint32_t *level_set;
+
+    memset(domain_ctx_table, 0, sizeof(domain_ctx_table));
+    memcpy(compact_domains, domains, sizeof(compact_domains));
+    compact_domains[0].fch_compact = true;
+    config.domains = &compact_domains;
+    config.fch_compact_config = &compact_config;
+    scmi_perf_ctx.config = &config;
+    scmi_perf_ctx.domain_ctx_table = domain_ctx_table;
+    perf_fch_ctx.api_fch_stub = &api;
+    perf_set_level_count = 0;
+    perf_set_limits_count = 0;
+
+    level_set = get_fch_local_address(0, MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET);
+    TEST_ASSERT_EQUAL_PTR(&region[2], level_set);
+    TEST_ASSERT_EQUAL_PTR(
+        &region[2 + SCMI_PERF_ELEMENT_IDX_COUNT],
+        get_fch_local_address(0, MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET));
+
+    fch_ctx = &domain_ctx_table[0].fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET];
+    TEST_ASSERT_EQUAL(
+        SCP_SCMI_FAST_CHANNEL_BASE +
+            sizeof(struct mod_scmi_perf_fch_compact_header) +
+            (SCMI_PERF_ELEMENT_IDX_COUNT * sizeof(uint32_t)),
+        fch_ctx->fch_address.target_view_address);
+    TEST_ASSERT_EQUAL(
+        sizeof(struct mod_scmi_perf_fast_channel_limit),
+        fch_ctx->fch_address.length);
+
+    initialize_fch_compact_region();
+
+    /* Nothing changed, the poll does not scan the region */
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(0, perf_set_level_count);
+    TEST_ASSERT_EQUAL(0, perf_set_limits_count);
+
+    /* Only the level set group was updated */
+    *level_set = test_dvfs_config.opps[1].level;
+    header->level_set_sequence++;
+
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, perf_set_level_count);
+    TEST_ASSERT_EQUAL(0, perf_set_limits_count);
+
+    perf_fch_process();
+    TEST_ASSERT_EQUAL(1, perf_set_level_count);
+
+    perf_fch_ctx.compact_header = NULL;
+}
+
+/*
+ * Test that the sequence words only apply to the domains using the compact
+ * layout.
+ */
+void utest_perf_fch_compact_opt_in(void)
+{
+    struct mod_scmi_perf_fch_compact_header header = { 0 };
+    struct mod_scmi_perf_fch_compact_config compact_config = {
+        .local_view_address = (uintptr_t)&header,
+    };
+    struct mod_scmi_perf_config config = perf_config;
+    struct scmi_perf_domain_ctx domain_ctx_table[SCMI_PERF_ELEMENT_IDX_COUNT];
+    struct mod_scmi_perf_fast_channel_limit *set_limit;
+    uint32_t *set_level;
+    uint32_t level;
+    bool level_set_changed;
+    bool limit_set_changed;
+
+    memset(domain_ctx_table, 0, sizeof(domain_ctx_table));
+    domain_ctx_table[0]
+        .fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET]
+        .fch_address.local_view_address = (uintptr_t)&level;
+    config.fch_compact_config = &compact_config;
+    scmi_perf_ctx.config = &config;
+    scmi_perf_ctx.domain_ctx_table = domain_ctx_table;
+
+    initialize_fch_compact_region();
+    TEST_ASSERT_FALSE(perf_fch_ctx.compact_only);
+
+    /* The domain using transport channels is still processed */
+    TEST_ASSERT_TRUE(fch_compact_poll(&level_set_changed, &limit_set_changed));
+    TEST_ASSERT_FALSE(level_set_changed);
+    TEST_ASSERT_FALSE(limit_set_changed);
+
+    get_fc_set_addrs(
+        0, level_set_changed, limit_set_changed, &set_level, &set_limit);
+    TEST_ASSERT_EQUAL_PTR(&level, set_level);
+
+    perf_fch_ctx.compact_header = NULL;
+}
+
+void utest_perf_fch_init_compact_without_region(void)
+{
+    struct mod_scmi_perf_domain_config
+        compact_domains[SCMI_PERF_ELEMENT_IDX_COUNT];
+    struct mod_scmi_perf_config config = perf_config;
+    struct mod_scmi_perf_private_api_perf_stub api;
+    int status;
+
+    memcpy(compact_domains, domains, sizeof(compact_domains));
+    compact_domains[0].fch_compact = true;
+    config.domains = &compact_domains;
+    scmi_perf_ctx.config = &config;
+
+    status = perf_fch_init(
+        fwk_module_id_scmi_perf, 0, NULL, &scmi_perf_ctx, &api);
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+}
+
 int scmi_perf_fch_test_main(void)
 {
     UNITY_BEGIN();
@@ -549,6 +708,9 @@ int scmi_perf_fch_test_main(void)
     RUN_TEST(utest_scmi_perf_describe_fast_channels_invalid_message_id);
 
     RUN_TEST(utest_perf_fch_init_success);
+    RUN_TEST(utest_perf_fch_process_compact);
+    RUN_TEST(utest_perf_fch_compact_opt_in);
+    RUN_TEST(utest_perf_fch_init_compact_without_region);
 
     return UNITY_END();
 }
@@ -23,6 +23,7 @@
 
 #define TEST_MODULE_IDX       0x5
 #define TEST_SCMI_AGENT_IDX_0 0x1
+#define TEST_SCMI_AGENT_IDX_1 0x2
 
 #define TEST_OPP_COUNT 0x5
 
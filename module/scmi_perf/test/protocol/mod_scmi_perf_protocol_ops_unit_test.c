@@ -30,6 +30,8 @@
 #include <fwk_element.h>
 #include <fwk_macros.h>
 
+#include <string.h>
+
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
 #    include <scmi_perf_fastchannels.c>
 #endif
@@ -42,6 +44,66 @@
 
 static int return_status;
 
+/*
+ * Outbound payload area handed out by the response builder. Responses built
+ * in place are checked directly in this buffer.
+ */
+static uint32_t response_buffer[32];
+static size_t response_capacity;
+static unsigned int response_commit_count;
+
+static int response_builder_init_fake(
+    fwk_id_t service_id,
+    struct mod_scmi_response_builder *builder)
+{
+    *builder = (struct mod_scmi_response_builder){
+        .payload = (uint8_t *)response_buffer,
+        .capacity = response_capacity,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static void *response_reserve_fake(
+    struct mod_scmi_response_builder *builder,
+    size_t size)
+{
+    void *area;
+
+    if (size > (builder->capacity - builder->length)) {
+        builder->overflow = true;
+        return NULL;
+    }
+
+    area = &builder->payload[builder->length];
+    builder->length += size;
+
+    return area;
+}
+
+static int response_commit_fake(
+    fwk_id_t service_id,
+    struct mod_scmi_response_builder *builder)
+{
+    TEST_ASSERT_FALSE(builder->overflow);
+    response_commit_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int get_opp_table_fake(
+    fwk_id_t domain_id,
+    const struct mod_dvfs_opp **opps,
+    size_t *opp_count,
+    uint16_t *latency)
+{
+    *opps = test_dvfs_config.opps;
+    *opp_count = TEST_OPP_COUNT;
+    *latency = test_dvfs_config.latency;
+
+    return FWK_SUCCESS;
+}
+
 static struct mod_scmi_perf_ctx scmi_perf_ctx;
 
 struct mod_scmi_to_protocol_api *to_protocol_api = NULL;
@@ -55,6 +117,9 @@ struct mod_scmi_from_protocol_api from_protocol_api = {
     .respond = mod_scmi_from_protocol_api_respond,
     .scmi_message_validation = mod_scmi_from_protocol_api_scmi_frame_validation,
     .notify = mod_scmi_from_protocol_api_notify,
+    .response_builder_init = response_builder_init_fake,
+    .response_reserve = response_reserve_fake,
+    .response_commit = response_commit_fake,
 };
 
 static const struct mod_dvfs_domain_api dvfs_domain_api = {
@@ -64,6 +129,7 @@ static const struct mod_dvfs_domain_api dvfs_domain_api = {
     .get_level_id = mod_dvfs_domain_api_get_level_id,
     .get_opp_count = mod_dvfs_domain_api_get_opp_count,
     .get_latency = mod_dvfs_domain_api_get_latency,
+    .get_opp_table = get_opp_table_fake,
     .set_level = mod_dvfs_domain_api_set_level,
 };
 
@@ -85,6 +151,10 @@ void setUp(void)
 #endif
 
     scmi_perf_ctx.dvfs_api = &dvfs_domain_api;
+
+    memset(response_buffer, 0, sizeof(response_buffer));
+    response_capacity = sizeof(response_buffer);
+    response_commit_count = 0;
 }
 
 void tearDown(void)
@@ -428,55 +498,35 @@ void utest_scmi_perf_domain_attributes_handler_invalid_param(void)
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
 }
 
-/*
- * As the dvfs_get_nth_opp function is mocked, we must manually return the
- * requested OPP
- */
-int get_nth_opp_callback(
-    fwk_id_t domain_id,
-    size_t n,
-    struct mod_dvfs_opp *opp,
-    int NumCalls)
-{
-    *opp = test_dvfs_config.opps[n];
-    return FWK_SUCCESS;
-}
-
 /*
  * Check that each of the returned levels is correct. Also, check that the
  * final returned status and number of levels is correct.
  */
-int describe_levels_handler_valid_param_write_payload_callback(
-    fwk_id_t service_id,
-    size_t offset,
-    const void *payload,
-    size_t size,
-    int NumCalls)
+static void check_describe_levels_response(
+    unsigned int level_index,
+    unsigned int num_levels)
 {
-    if (NumCalls < TEST_OPP_COUNT) {
-        struct scmi_perf_level *returned_perf_level =
-            (struct scmi_perf_level *)payload;
+    unsigned int i;
+    struct scmi_perf_describe_levels_p2a *return_values =
+        (struct scmi_perf_describe_levels_p2a *)response_buffer;
+
+    TEST_ASSERT_EQUAL(1, response_commit_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        SCMI_PERF_NUM_LEVELS(
+            num_levels, TEST_OPP_COUNT - level_index - num_levels),
+        return_values->num_levels);
 
+    for (i = 0; i < num_levels; i++) {
         TEST_ASSERT_EQUAL(
-            test_dvfs_config.opps[NumCalls].voltage,
-            returned_perf_level->power_cost);
+            test_dvfs_config.opps[level_index + i].voltage,
+            return_values->perf_levels[i].power_cost);
         TEST_ASSERT_EQUAL(
-            test_dvfs_config.opps[NumCalls].level,
-            returned_perf_level->performance_level);
+            test_dvfs_config.opps[level_index + i].level,
+            return_values->perf_levels[i].performance_level);
         TEST_ASSERT_EQUAL(
-            test_dvfs_config.latency, returned_perf_level->attributes);
-
-    } else if (NumCalls == TEST_OPP_COUNT) {
-        struct scmi_perf_describe_levels_p2a *return_values =
-            (struct scmi_perf_describe_levels_p2a *)payload;
-        TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
-        TEST_ASSERT_EQUAL(TEST_OPP_COUNT, return_values->num_levels);
-
-    } else {
-        return FWK_E_RANGE;
+            test_dvfs_config.latency, return_values->perf_levels[i].attributes);
     }
-
-    return FWK_SUCCESS;
 }
 
 void utest_scmi_perf_describe_levels_handler_valid_param(void)
@@ -491,32 +541,44 @@ void utest_scmi_perf_describe_levels_handler_valid_param(void)
         .level_index = 0,
     };
 
-    size_t size = UINT16_MAX;
-    size_t opp_count = TEST_OPP_COUNT;
-    uint16_t latency = test_dvfs_config.latency;
-
     /*
-     * Return an arbitrarily large max_payload_size as we are just testing
-     * whether the returned levels are correct and in the right order
+     * The default payload area is large enough for the whole table as we are
+     * just testing whether the returned levels are correct and in the right
+     * order
      */
-    mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
-        FWK_SUCCESS);
-    mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
+    mod_scmi_from_protocol_api_scmi_frame_validation_ExpectAnyArgsAndReturn(
+        SCMI_SUCCESS);
 
-    mod_dvfs_domain_api_get_opp_count_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_opp_count_ReturnThruPtr_opp_count(&opp_count);
+    status = to_protocol_api->message_handler(
+        (fwk_id_t)MOD_SCMI_PROTOCOL_ID_PERF,
+        service_id,
+        (const uint32_t *)&payload,
+        payload_size_table[MOD_SCMI_PERF_DESCRIBE_LEVELS],
+        MOD_SCMI_PERF_DESCRIBE_LEVELS);
 
-    mod_dvfs_domain_api_get_latency_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_latency_ReturnThruPtr_latency(&latency);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    check_describe_levels_response(0, TEST_OPP_COUNT);
+}
 
-    mod_dvfs_domain_api_get_nth_opp_Stub(get_nth_opp_callback);
+/*
+ * Test the describe_levels_handler function returns the window of levels
+ * which fits in the payload area, starting from the requested level_index.
+ */
+void utest_scmi_perf_describe_levels_handler_partial(void)
+{
+    int status;
 
-    mod_scmi_from_protocol_api_write_payload_Stub(
-        describe_levels_handler_valid_param_write_payload_callback);
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+
+    struct scmi_perf_describe_levels_a2p payload = {
+        .domain_id = 0,
+        .level_index = 1,
+    };
+
+    response_capacity = sizeof(struct scmi_perf_describe_levels_p2a) +
+        (2 * sizeof(struct scmi_perf_level));
 
-    /* Disable the previous callback for this function */
-    mod_scmi_from_protocol_api_respond_Stub(NULL);
-    mod_scmi_from_protocol_api_respond_ExpectAnyArgsAndReturn(FWK_SUCCESS);
     mod_scmi_from_protocol_api_scmi_frame_validation_ExpectAnyArgsAndReturn(
         SCMI_SUCCESS);
 
@@ -528,6 +590,7 @@ void utest_scmi_perf_describe_levels_handler_valid_param(void)
         MOD_SCMI_PERF_DESCRIBE_LEVELS);
 
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    check_describe_levels_response(1, 2);
 }
 
 /* Test the describe_levels_handler function with an invalid domain_id */
@@ -555,12 +618,6 @@ void utest_scmi_perf_describe_levels_handler_invalid_domain_id(void)
         .level_index = 0,
     };
 
-    size_t size = UINT16_MAX;
-
-    mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
-        FWK_SUCCESS);
-    mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
-
     mod_scmi_from_protocol_api_respond_Stub(
         describe_levels_handler_invalid_domain_id_respond_callback);
     mod_scmi_from_protocol_api_scmi_frame_validation_ExpectAnyArgsAndReturn(
@@ -601,16 +658,6 @@ void utest_scmi_perf_describe_levels_handler_invalid_level_index(void)
         .level_index = TEST_OPP_COUNT,
     };
 
-    size_t size = UINT16_MAX;
-    size_t opp_count = TEST_OPP_COUNT;
-
-    mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
-        FWK_SUCCESS);
-    mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
-
-    mod_dvfs_domain_api_get_opp_count_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_opp_count_ReturnThruPtr_opp_count(&opp_count);
-
     mod_scmi_from_protocol_api_respond_Stub(
         describe_levels_handler_invalid_level_index_respond_callback);
     mod_scmi_from_protocol_api_scmi_frame_validation_ExpectAnyArgsAndReturn(
@@ -1023,6 +1070,148 @@ void utest_scmi_perf_message_handler_not_found(void)
     TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
 }
 
+/*
+ * Test the level_get handler replies from the cached level of the domain
+ * without querying DVFS.
+ */
+int level_get_handler_cached_level_respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    struct scmi_perf_level_get_p2a *return_values;
+    return_values = (struct scmi_perf_level_get_p2a *)payload;
+
+    TEST_ASSERT_EQUAL((int32_t)SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        test_dvfs_config.opps[1].level, return_values->performance_level);
+    TEST_ASSERT_EQUAL(sizeof(struct scmi_perf_level_get_p2a), size);
+
+    return FWK_SUCCESS;
+}
+
+void utest_scmi_perf_level_get_handler_cached_level(void)
+{
+    int status;
+    struct scmi_perf_domain_ctx domain0_ctx = {
+        .curr_level = test_dvfs_config.opps[1].level,
+    };
+    struct perf_operations perf_ops = { 0 };
+
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+
+    struct scmi_perf_level_get_a2p payload = {
+        .domain_id = 0,
+    };
+
+    scmi_perf_ctx.domain_ctx_table = &domain0_ctx;
+    perf_prot_ctx.perf_ops_table = &perf_ops;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    mod_scmi_from_protocol_api_respond_Stub(
+        level_get_handler_cached_level_respond_callback);
+
+    status = scmi_perf_level_get_handler(service_id, (const uint32_t *)&payload);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, perf_ops.waiting_count);
+}
+
+/*
+ * Test concurrent level_get requests on a domain are all answered from a
+ * single DVFS result.
+ */
+int level_get_handler_coalesced_respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    struct scmi_perf_level_get_p2a *return_values;
+    return_values = (struct scmi_perf_level_get_p2a *)payload;
+
+    TEST_ASSERT_EQUAL((int32_t)SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        test_dvfs_config.opps[2].level, return_values->performance_level);
+    fwk_id_t expected_service_id = (NumCalls == 0) ?
+        FWK_ID_ELEMENT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0) :
+        FWK_ID_ELEMENT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_1);
+
+    TEST_ASSERT_EQUAL(expected_service_id.value, service_id.value);
+
+    return FWK_SUCCESS;
+}
+
+void utest_scmi_perf_level_get_handler_coalesced(void)
+{
+    int status;
+    struct scmi_perf_domain_ctx domain0_ctx = { 0 };
+    fwk_id_t waiting_service_ids[2];
+    struct perf_operations perf_ops = {
+        .waiting_service_ids = waiting_service_ids,
+    };
+    struct mod_dvfs_opp opp = test_dvfs_config.opps[2];
+    struct fwk_event event = {
+        .id = scmi_perf_get_level,
+    };
+    struct scmi_perf_event_parameters *evt_params =
+        (struct scmi_perf_event_parameters *)event.params;
+
+    fwk_id_t service_id_0 =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+    fwk_id_t service_id_1 =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_1);
+    fwk_id_t service_id_2 =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+
+    struct scmi_perf_level_get_a2p payload = {
+        .domain_id = 0,
+    };
+
+    scmi_perf_ctx.domain_ctx_table = &domain0_ctx;
+    perf_prot_ctx.perf_ops_table = &perf_ops;
+    perf_prot_ctx.level_get_queue_depth = FWK_ARRAY_SIZE(waiting_service_ids);
+
+    /* The first request queries DVFS */
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    status =
+        scmi_perf_level_get_handler(service_id_0, (const uint32_t *)&payload);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, perf_ops.waiting_count);
+
+    /* The second request waits for the same result */
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    status =
+        scmi_perf_level_get_handler(service_id_1, (const uint32_t *)&payload);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, perf_ops.waiting_count);
+
+    /* The queue is full, the request is rejected */
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    mod_scmi_from_protocol_api_respond_Stub(
+        version_handler_respond_callback_fail);
+    return_status = (int32_t)SCMI_BUSY;
+    status =
+        scmi_perf_level_get_handler(service_id_2, (const uint32_t *)&payload);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, perf_ops.waiting_count);
+
+    /* Both waiting agents are answered from the DVFS result */
+    evt_params->domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, 0);
+    mod_dvfs_domain_api_get_current_opp_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    mod_dvfs_domain_api_get_current_opp_ReturnThruPtr_opp(&opp);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    mod_scmi_from_protocol_api_respond_Stub(
+        level_get_handler_coalesced_respond_callback);
+
+    status = process_request_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(0, perf_ops.waiting_count);
+}
+
 int scmi_perf_protocol_ops_test_main(void)
 {
     UNITY_BEGIN();
@@ -1039,6 +1228,7 @@ int scmi_perf_protocol_ops_test_main(void)
     RUN_TEST(utest_scmi_perf_domain_attributes_handler_invalid_param);
 
     RUN_TEST(utest_scmi_perf_describe_levels_handler_valid_param);
+    RUN_TEST(utest_scmi_perf_describe_levels_handler_partial);
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_domain_id);
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_level_index);
 
@@ -1051,6 +1241,9 @@ int scmi_perf_protocol_ops_test_main(void)
     RUN_TEST(utest_scmi_perf_message_handler_not_found);
 #endif
 
+    RUN_TEST(utest_scmi_perf_level_get_handler_cached_level);
+    RUN_TEST(utest_scmi_perf_level_get_handler_coalesced);
+
     RUN_TEST(utest_find_opp_for_level_valid_level);
     RUN_TEST(utest_find_opp_for_level_invalid_level);
     RUN_TEST(utest_find_opp_for_level_use_nearest);
@@ -41,6 +41,9 @@ enum scmi_power_capping_event_idx {
 #endif
 #ifdef BUILD_HAS_SCMI_POWER_CAPPING_FAST_CHANNELS_COMMANDS
     SCMI_POWER_CAPPING_EVENT_IDX_FAST_CHANNELS_PROCESS,
+#endif
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    SCMI_POWER_CAPPING_EVENT_IDX_BURST_SAMPLE_PROCESS,
 #endif
     SCMI_POWER_CAPPING_EVENT_COUNT,
 };
@@ -0,0 +1,71 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI power capping and monitoring protocol burst support.
+ */
+
+#ifndef INTERNAL_SCMI_POWER_CAPPING_BURST_H
+#define INTERNAL_SCMI_POWER_CAPPING_BURST_H
+
+#include "internal/scmi_power_capping.h"
+
+#include <fwk_event.h>
+#include <fwk_id.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * \addtogroup GroupModules Modules
+ * \{
+ */
+
+/*!
+ * \defgroup GroupSCMI_POWER_CAPPING_BURST SCMI power capping burst
+ * \{
+ */
+
+/*!
+ * \brief Fixed point shift applied to the averaged power values.
+ */
+#define PCAPPING_BURST_AVG_SHIFT 8
+
+void pcapping_burst_ctx_init(struct mod_scmi_power_capping_context *ctx);
+
+int pcapping_burst_set_domain_config(
+    uint32_t domain_idx,
+    const struct mod_scmi_power_capping_domain_config *config);
+
+int pcapping_burst_bind(void);
+
+int pcapping_burst_start(fwk_id_t id);
+
+/*
+ * Interpose the burst accounting between the protocol handlers and the power
+ * allocator. The power allocator API of the given table is replaced by one
+ * enforcing the requested caps as averages for the domains using bursts.
+ */
+void pcapping_burst_set_power_apis(
+    struct mod_scmi_power_capping_power_apis *power_management_apis);
+
+int pcapping_burst_process_event(const struct fwk_event *event);
+
+/*
+ * Returns true when the notification results from a cap adjusted by the burst
+ * accounting, in which case it must not be reported to the agents.
+ */
+bool pcapping_burst_filter_fwk_notification(const struct fwk_event *event);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \}
+ */
+
+#endif /* INTERNAL_SCMI_POWER_CAPPING_BURST_H */
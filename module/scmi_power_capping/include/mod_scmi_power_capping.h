@@ -64,6 +64,70 @@ struct scmi_pcapping_fch_config {
     bool fch_support;
 };
 
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+/*!
+ * \brief Power capping burst configuration.
+ *
+ * \details When a domain provides a burst configuration the power cap
+ *      requested by an agent is enforced as an average over the power
+ *      averaging interval (PAI) instead of being applied as an instantaneous
+ *      limit. The power meter is sampled periodically and the domain is
+ *      allowed to draw more than the requested cap while the energy consumed
+ *      over the PAI stays within budget. The burst itself is bounded by a
+ *      second, shorter averaging window.
+ */
+struct mod_scmi_power_capping_burst_config {
+    /*!
+     * \brief Burst power cap.
+     *
+     * \details The limit enforced as an average over the burst window. When
+     *      lower than the cap requested by an agent, the requested cap is
+     *      used instead.
+     */
+    uint32_t burst_power_cap;
+
+    /*!
+     * \brief Burst window.
+     *
+     * \details The averaging window of the burst power cap, expressed in
+     *      milliseconds. Its value cannot be lower than the sample period.
+     */
+    uint32_t burst_window;
+
+    /*!
+     * \brief Peak power cap.
+     *
+     * \details The highest power cap forwarded to the power allocator while
+     *      the domain is bursting.
+     */
+    uint32_t peak_power_cap;
+
+    /*!
+     * \brief Floor power cap.
+     *
+     * \details The lowest power cap forwarded to the power allocator while
+     *      the domain pays back the energy consumed during a burst. Its value
+     *      cannot be zero.
+     */
+    uint32_t floor_power_cap;
+
+    /*!
+     * \brief Sample period.
+     *
+     * \details The period at which the power meter is sampled, expressed in
+     *      milliseconds. Its value cannot be zero.
+     */
+    uint32_t sample_period;
+
+    /*!
+     * \brief Alarm ID.
+     *
+     * \details The timer alarm used to sample the power meter.
+     */
+    fwk_id_t alarm_id;
+};
+#endif
+
 /*!
  * \brief SCMI Power capping domain configuration.
  */
@@ -163,6 +227,15 @@ struct mod_scmi_power_capping_domain_config {
      *      this domain.
      */
     const struct scmi_pcapping_fch_config *fch_config;
+#endif
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    /*!
+     * \brief Burst configuration.
+     *
+     * \details Optional, the requested power cap is forwarded as is to the
+     *      power allocator when this is NULL.
+     */
+    const struct mod_scmi_power_capping_burst_config *burst_config;
 #endif
     /*!
      * \brief ID of the corresponding power allocator domain.
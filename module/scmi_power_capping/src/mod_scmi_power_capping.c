@@ -17,6 +17,9 @@
 #    include "internal/scmi_power_capping.h"
 #    include "internal/scmi_power_capping_fast_channels.h"
 #endif
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+#    include "internal/scmi_power_capping_burst.h"
+#endif
 
 #include <fwk_module.h>
 
@@ -28,6 +31,12 @@ static const fwk_id_t mod_scmi_power_capping_event_id_fch_callback =
         FWK_MODULE_IDX_SCMI_POWER_CAPPING,
         SCMI_POWER_CAPPING_EVENT_IDX_FAST_CHANNELS_PROCESS);
 #endif
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+static const fwk_id_t mod_scmi_power_capping_event_id_burst_sample =
+    FWK_ID_EVENT_INIT(
+        FWK_MODULE_IDX_SCMI_POWER_CAPPING,
+        SCMI_POWER_CAPPING_EVENT_IDX_BURST_SAMPLE_PROCESS);
+#endif
 
 static int scmi_power_capping_power_api_bind(
     struct mod_scmi_power_capping_power_apis *power_apis)
@@ -95,6 +104,10 @@ static int scmi_power_capping_init(
     pcapping_fast_channel_ctx_init(&ctx);
 #endif
 
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    pcapping_burst_ctx_init(&ctx);
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -105,7 +118,8 @@ static int scmi_power_capping_element_init(
 {
     const struct mod_scmi_power_capping_domain_config *config;
     unsigned int domain_idx;
-#ifdef BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS
+#if defined(BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS) || \
+    defined(BUILD_HAS_SCMI_POWER_CAPPING_BURST)
     int status;
 #endif
 
@@ -126,6 +140,13 @@ static int scmi_power_capping_element_init(
 #ifdef BUILD_HAS_SCMI_POWER_CAPPING_FAST_CHANNELS_COMMANDS
     pcapping_fast_channel_set_domain_config(domain_idx, config);
 #endif
+
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    status = pcapping_burst_set_domain_config(domain_idx, config);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
     return FWK_SUCCESS;
 }
 
@@ -137,6 +158,18 @@ static int scmi_power_capping_bind(fwk_id_t id, unsigned int round)
         return FWK_SUCCESS;
     }
     status = scmi_power_capping_power_api_bind(&power_management_apis);
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = pcapping_burst_bind();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+    pcapping_burst_set_power_apis(&power_management_apis);
+#endif
+
 #ifdef BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS
     if (status != FWK_SUCCESS) {
         return status;
@@ -162,6 +195,15 @@ static int scmi_power_capping_bind(fwk_id_t id, unsigned int round)
 
 static int scmi_power_capping_start(fwk_id_t id)
 {
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    int status;
+
+    status = pcapping_burst_start(id);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
 #ifdef BUILD_HAS_SCMI_POWER_CAPPING_FAST_CHANNELS_COMMANDS
     pcapping_fast_channel_start();
 #endif
@@ -177,6 +219,12 @@ static int scmi_power_capping_process_notification(
     const struct fwk_event *event,
     struct fwk_event *resp_event)
 {
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    if (pcapping_burst_filter_fwk_notification(event)) {
+        return FWK_SUCCESS;
+    }
+#endif
+
 #ifdef BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS
     return pcapping_protocol_process_fwk_notification(event);
 #else
@@ -210,6 +258,13 @@ static int scmi_power_capping_process_event(
     }
 #endif
 
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    if (fwk_id_is_equal(
+            event->id, mod_scmi_power_capping_event_id_burst_sample)) {
+        return pcapping_burst_process_event(event);
+    }
+#endif
+
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     if (fwk_id_is_equal(
             event->id, mod_scmi_power_capping_event_id_cap_pai_notify)) {
@@ -227,7 +282,8 @@ static int scmi_power_capping_process_event(
 const struct fwk_module module_scmi_power_capping = {
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .api_count = (unsigned int)MOD_SCMI_POWER_CAPPING_API_IDX_COUNT,
-#ifdef BUILD_HAS_SCMI_POWER_CAPPING_FAST_CHANNELS_COMMANDS
+#if defined(BUILD_HAS_SCMI_POWER_CAPPING_FAST_CHANNELS_COMMANDS) || \
+    defined(BUILD_HAS_SCMI_POWER_CAPPING_BURST)
     .event_count = (unsigned int)SCMI_POWER_CAPPING_EVENT_COUNT,
 #endif
     .init = scmi_power_capping_init,
@@ -0,0 +1,552 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI power capping and monitoring protocol burst support.
+ *
+ *      The power consumed by a domain is averaged over two windows: the power
+ *      averaging interval (PAI) of the domain and a shorter burst window. The
+ *      cap forwarded to the power allocator is the highest power that keeps
+ *      both averages within their limits after the next sample, so a domain
+ *      consuming less than its requested cap builds up a budget it can later
+ *      spend in bursts.
+ */
+
+#include "internal/scmi_power_capping.h"
+#include "internal/scmi_power_capping_burst.h"
+
+#include <mod_timer.h>
+
+#include <fwk_core.h>
+#include <fwk_event.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_mm.h>
+#include <fwk_module.h>
+#include <fwk_notification.h>
+#include <fwk_status.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Number of microseconds per millisecond */
+#define PCAPPING_BURST_US_PER_MS 1000u
+
+struct pcapping_burst_ctx {
+    /* Burst configuration, NULL when the domain does not burst */
+    const struct mod_scmi_power_capping_burst_config *config;
+
+    /* Cap requested by the agents, enforced as an average over the PAI */
+    uint32_t requested_cap;
+
+    /* Cap currently applied by the power allocator */
+    uint32_t applied_cap;
+
+    /* Average power over the PAI */
+    uint64_t long_avg;
+
+    /* Average power over the burst window */
+    uint64_t short_avg;
+
+    /* A cap is requested and enforced as an average */
+    bool active;
+
+    /* The power allocator is applying a cap requested by an agent */
+    bool agent_update_pending;
+
+    /* The power allocator is applying a cap adjusted by the accounting */
+    bool internal_update_pending;
+};
+
+static struct {
+    /* Table of power capping domain contexts */
+    struct mod_scmi_power_capping_domain_context
+        *power_capping_domain_ctx_table;
+
+    /* Table of burst contexts */
+    struct pcapping_burst_ctx *burst_ctx_table;
+
+    /* Power capping domain count */
+    uint32_t domain_count;
+
+    /* Power management related APIs */
+    const struct mod_scmi_power_capping_power_apis *power_management_apis;
+
+    /* Power allocator API the adjusted caps are forwarded to */
+    const struct mod_power_allocator_api *power_allocator_api;
+
+    /* Timer alarm API */
+    const struct mod_timer_alarm_api *alarm_api;
+} pcapping_burst_global_ctx;
+
+static const fwk_id_t pcapping_burst_cap_notification =
+    FWK_ID_NOTIFICATION_INIT(
+        FWK_MODULE_IDX_POWER_ALLOCATOR,
+        MOD_POWER_ALLOCATOR_NOTIFICATION_IDX_CAP_CHANGED);
+
+/*
+ * Helper functions
+ */
+
+static fwk_id_t pcapping_burst_get_power_allocator_id(uint32_t domain_idx)
+{
+    return pcapping_burst_global_ctx.power_capping_domain_ctx_table[domain_idx]
+        .config->power_allocator_domain_id;
+}
+
+static struct pcapping_burst_ctx *pcapping_burst_find_ctx(
+    fwk_id_t power_allocator_id)
+{
+    uint32_t domain_idx;
+    struct pcapping_burst_ctx *burst_ctx;
+
+    for (domain_idx = 0; domain_idx < pcapping_burst_global_ctx.domain_count;
+         domain_idx++) {
+        burst_ctx = &pcapping_burst_global_ctx.burst_ctx_table[domain_idx];
+        if ((burst_ctx->config != NULL) &&
+            fwk_id_is_equal(
+                pcapping_burst_get_power_allocator_id(domain_idx),
+                power_allocator_id)) {
+            return burst_ctx;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Number of samples in an averaging window, the averages are updated with a
+ * weight of one over this ratio.
+ */
+static uint32_t pcapping_burst_window_ratio(uint32_t window, uint32_t period)
+{
+    uint32_t ratio = window / period;
+
+    return (ratio == 0u) ? 1u : ratio;
+}
+
+static void pcapping_burst_update_avg(
+    uint64_t *avg,
+    uint32_t power,
+    uint32_t ratio)
+{
+    int64_t delta;
+
+    delta = (int64_t)((uint64_t)power << PCAPPING_BURST_AVG_SHIFT) -
+        (int64_t)*avg;
+
+    *avg = (uint64_t)((int64_t)*avg + (delta / (int64_t)ratio));
+}
+
+/*
+ * Highest power that keeps the average over a window at or below the given
+ * limit after the next sample.
+ */
+static uint64_t pcapping_burst_window_limit(
+    uint64_t avg,
+    uint32_t limit,
+    uint32_t ratio)
+{
+    int64_t headroom;
+    int64_t allowed;
+
+    headroom = (int64_t)((uint64_t)limit << PCAPPING_BURST_AVG_SHIFT) -
+        (int64_t)avg;
+    allowed = (int64_t)avg + (headroom * (int64_t)ratio);
+
+    if (allowed <= 0) {
+        return 0u;
+    }
+
+    return (uint64_t)allowed >> PCAPPING_BURST_AVG_SHIFT;
+}
+
+static uint32_t pcapping_burst_compute_cap(
+    const struct pcapping_burst_ctx *burst_ctx,
+    uint32_t long_ratio,
+    uint32_t short_ratio)
+{
+    const struct mod_scmi_power_capping_burst_config *config;
+    uint32_t burst_power_cap;
+    uint64_t cap;
+    uint64_t short_limit;
+
+    config = burst_ctx->config;
+
+    burst_power_cap = (config->burst_power_cap > burst_ctx->requested_cap) ?
+        config->burst_power_cap :
+        burst_ctx->requested_cap;
+
+    cap = pcapping_burst_window_limit(
+        burst_ctx->long_avg, burst_ctx->requested_cap, long_ratio);
+    short_limit = pcapping_burst_window_limit(
+        burst_ctx->short_avg, burst_power_cap, short_ratio);
+
+    if (short_limit < cap) {
+        cap = short_limit;
+    }
+
+    if (cap > config->peak_power_cap) {
+        cap = config->peak_power_cap;
+    }
+
+    if (cap < config->floor_power_cap) {
+        cap = config->floor_power_cap;
+    }
+
+    return (uint32_t)cap;
+}
+
+static int pcapping_burst_get_long_ratio(
+    uint32_t domain_idx,
+    const struct pcapping_burst_ctx *burst_ctx,
+    uint32_t *ratio)
+{
+    int status;
+    uint32_t pai;
+
+    status = pcapping_burst_global_ctx.power_management_apis
+                 ->power_coordinator_api->get_coordinator_period(
+                     pcapping_burst_global_ctx
+                         .power_capping_domain_ctx_table[domain_idx]
+                         .config->power_coordinator_domain_id,
+                     &pai);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *ratio = pcapping_burst_window_ratio(
+        pai / PCAPPING_BURST_US_PER_MS, burst_ctx->config->sample_period);
+
+    return FWK_SUCCESS;
+}
+
+static void pcapping_burst_alarm_callback(uintptr_t param)
+{
+    int status;
+    uint32_t *event_param;
+
+    struct fwk_event event = (struct fwk_event){
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_SCMI_POWER_CAPPING,
+            SCMI_POWER_CAPPING_EVENT_IDX_BURST_SAMPLE_PROCESS),
+        .source_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_POWER_CAPPING),
+        .target_id = FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_POWER_CAPPING),
+    };
+    event_param = (uint32_t *)event.params;
+    *event_param = (uint32_t)param;
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR("[SCMI-Power-Capping-Burst] Error creating sample event.");
+    }
+}
+
+/*
+ * Power allocator API exposed to the protocol handlers
+ */
+
+static int pcapping_burst_get_cap(fwk_id_t domain_id, uint32_t *cap)
+{
+    struct pcapping_burst_ctx *burst_ctx;
+
+    burst_ctx = pcapping_burst_find_ctx(domain_id);
+
+    if ((burst_ctx == NULL) || !burst_ctx->active) {
+        return pcapping_burst_global_ctx.power_allocator_api->get_cap(
+            domain_id, cap);
+    }
+
+    *cap = burst_ctx->requested_cap;
+
+    return FWK_SUCCESS;
+}
+
+static int pcapping_burst_set_cap(fwk_id_t domain_id, uint32_t cap)
+{
+    struct pcapping_burst_ctx *burst_ctx;
+    uint32_t domain_idx;
+    uint32_t long_ratio;
+    uint32_t short_ratio;
+    int status;
+
+    burst_ctx = pcapping_burst_find_ctx(domain_id);
+
+    if (burst_ctx == NULL) {
+        return pcapping_burst_global_ctx.power_allocator_api->set_cap(
+            domain_id, cap);
+    }
+
+    /* A zero cap disables capping, there is nothing to enforce */
+    burst_ctx->active = (cap != 0u);
+    burst_ctx->requested_cap = cap;
+    burst_ctx->internal_update_pending = false;
+
+    if (burst_ctx->active) {
+        domain_idx =
+            (uint32_t)(burst_ctx - pcapping_burst_global_ctx.burst_ctx_table);
+
+        status = pcapping_burst_get_long_ratio(
+            domain_idx, burst_ctx, &long_ratio);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        short_ratio = pcapping_burst_window_ratio(
+            burst_ctx->config->burst_window, burst_ctx->config->sample_period);
+        cap = pcapping_burst_compute_cap(burst_ctx, long_ratio, short_ratio);
+    }
+
+    status = pcapping_burst_global_ctx.power_allocator_api->set_cap(
+        domain_id, cap);
+
+    if ((status == FWK_SUCCESS) || (status == FWK_PENDING)) {
+        burst_ctx->applied_cap = cap;
+        burst_ctx->agent_update_pending = (status == FWK_PENDING);
+    }
+
+    return status;
+}
+
+static const struct mod_power_allocator_api
+    pcapping_burst_power_allocator_api = {
+        .get_cap = pcapping_burst_get_cap,
+        .set_cap = pcapping_burst_set_cap,
+    };
+
+/*
+ * Sampling
+ */
+
+static int pcapping_burst_process_sample(uint32_t domain_idx)
+{
+    struct pcapping_burst_ctx *burst_ctx;
+    uint32_t long_ratio;
+    uint32_t short_ratio;
+    uint32_t power;
+    uint32_t cap;
+    int status;
+
+    if (domain_idx >= pcapping_burst_global_ctx.domain_count) {
+        return FWK_E_PARAM;
+    }
+
+    burst_ctx = &pcapping_burst_global_ctx.burst_ctx_table[domain_idx];
+
+    status = pcapping_burst_global_ctx.power_management_apis->power_meter_api
+                 ->get_power(
+                     pcapping_burst_global_ctx
+                         .power_capping_domain_ctx_table[domain_idx]
+                         .config->power_meter_domain_id,
+                     &power);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = pcapping_burst_get_long_ratio(domain_idx, burst_ctx, &long_ratio);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    short_ratio = pcapping_burst_window_ratio(
+        burst_ctx->config->burst_window, burst_ctx->config->sample_period);
+
+    /* The energy consumed is accounted for even when capping is disabled */
+    pcapping_burst_update_avg(&burst_ctx->long_avg, power, long_ratio);
+    pcapping_burst_update_avg(&burst_ctx->short_avg, power, short_ratio);
+
+    /*
+     * Caps are only adjusted once the power allocator has applied the previous
+     * one so that the notifications can be told apart.
+     */
+    if (!burst_ctx->active || burst_ctx->agent_update_pending ||
+        burst_ctx->internal_update_pending) {
+        return FWK_SUCCESS;
+    }
+
+    cap = pcapping_burst_compute_cap(burst_ctx, long_ratio, short_ratio);
+    if (cap == burst_ctx->applied_cap) {
+        return FWK_SUCCESS;
+    }
+
+    status = pcapping_burst_global_ctx.power_allocator_api->set_cap(
+        pcapping_burst_get_power_allocator_id(domain_idx), cap);
+
+    if (status == FWK_PENDING) {
+        burst_ctx->internal_update_pending = true;
+        status = FWK_SUCCESS;
+    }
+
+    if (status == FWK_SUCCESS) {
+        burst_ctx->applied_cap = cap;
+    }
+
+    return status;
+}
+
+/*
+ * Framework interface
+ */
+
+void pcapping_burst_ctx_init(struct mod_scmi_power_capping_context *ctx)
+{
+    pcapping_burst_global_ctx.domain_count = ctx->domain_count;
+
+    pcapping_burst_global_ctx.power_capping_domain_ctx_table =
+        ctx->power_capping_domain_ctx_table;
+
+    pcapping_burst_global_ctx.burst_ctx_table = fwk_mm_calloc(
+        ctx->domain_count, sizeof(struct pcapping_burst_ctx));
+}
+
+int pcapping_burst_set_domain_config(
+    uint32_t domain_idx,
+    const struct mod_scmi_power_capping_domain_config *config)
+{
+    const struct mod_scmi_power_capping_burst_config *burst_config;
+
+    if (domain_idx >= pcapping_burst_global_ctx.domain_count) {
+        return FWK_E_PARAM;
+    }
+
+    burst_config = config->burst_config;
+
+    if (burst_config != NULL) {
+        if ((burst_config->sample_period == 0u) ||
+            (burst_config->floor_power_cap == 0u) ||
+            (burst_config->burst_window < burst_config->sample_period) ||
+            (burst_config->peak_power_cap < burst_config->floor_power_cap)) {
+            return FWK_E_DATA;
+        }
+    }
+
+    pcapping_burst_global_ctx.burst_ctx_table[domain_idx].config = burst_config;
+
+    return FWK_SUCCESS;
+}
+
+int pcapping_burst_bind(void)
+{
+    int status;
+    uint32_t domain_idx;
+    struct pcapping_burst_ctx *burst_ctx;
+
+    for (domain_idx = 0; domain_idx < pcapping_burst_global_ctx.domain_count;
+         domain_idx++) {
+        burst_ctx = &pcapping_burst_global_ctx.burst_ctx_table[domain_idx];
+        if (burst_ctx->config != NULL) {
+            status = fwk_module_bind(
+                burst_ctx->config->alarm_id,
+                MOD_TIMER_API_ID_ALARM,
+                &pcapping_burst_global_ctx.alarm_api);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+int pcapping_burst_start(fwk_id_t id)
+{
+#ifndef BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS
+    int status;
+#endif
+    uint32_t domain_idx;
+    const struct mod_scmi_power_capping_burst_config *config;
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return FWK_SUCCESS;
+    }
+
+    domain_idx = fwk_id_get_element_idx(id);
+    config = pcapping_burst_global_ctx.burst_ctx_table[domain_idx].config;
+
+    if (config == NULL) {
+        return FWK_SUCCESS;
+    }
+
+#ifndef BUILD_HAS_SCMI_POWER_CAPPING_STD_COMMANDS
+    /*
+     * The protocol does not subscribe to the cap changes without the standard
+     * commands but they are still needed to track the pending caps.
+     */
+    status = fwk_notification_subscribe(
+        pcapping_burst_cap_notification,
+        FWK_ID_MODULE(FWK_MODULE_IDX_POWER_ALLOCATOR),
+        id);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return pcapping_burst_global_ctx.alarm_api->start(
+        config->alarm_id,
+        config->sample_period,
+        MOD_TIMER_ALARM_TYPE_PERIODIC,
+        pcapping_burst_alarm_callback,
+        (uintptr_t)domain_idx);
+}
+
+void pcapping_burst_set_power_apis(
+    struct mod_scmi_power_capping_power_apis *power_management_apis)
+{
+    pcapping_burst_global_ctx.power_management_apis = power_management_apis;
+    pcapping_burst_global_ctx.power_allocator_api =
+        power_management_apis->power_allocator_api;
+
+    power_management_apis->power_allocator_api =
+        &pcapping_burst_power_allocator_api;
+}
+
+int pcapping_burst_process_event(const struct fwk_event *event)
+{
+    return pcapping_burst_process_sample(*(const uint32_t *)event->params);
+}
+
+bool pcapping_burst_filter_fwk_notification(const struct fwk_event *event)
+{
+    const struct mod_power_allocator_notification_params *params;
+    struct pcapping_burst_ctx *burst_ctx;
+    uint32_t domain_idx;
+
+    if (!fwk_id_is_equal(event->id, pcapping_burst_cap_notification)) {
+        return false;
+    }
+
+    domain_idx = fwk_id_get_element_idx(event->target_id);
+    if (domain_idx >= pcapping_burst_global_ctx.domain_count) {
+        return false;
+    }
+
+    /*
+     * The power allocator notifies every domain from its module identifier,
+     * only the domain whose cap changed accounts for the notification.
+     */
+    params =
+        (const struct mod_power_allocator_notification_params *)event->params;
+    if (!fwk_id_is_equal(
+            pcapping_burst_get_power_allocator_id(domain_idx),
+            params->domain_id)) {
+        return false;
+    }
+
+    burst_ctx = &pcapping_burst_global_ctx.burst_ctx_table[domain_idx];
+
+    /* Notifications are delivered in the order the caps were set */
+    if (burst_ctx->agent_update_pending) {
+        burst_ctx->agent_update_pending = false;
+        return false;
+    }
+
+    if (burst_ctx->internal_update_pending) {
+        burst_ctx->internal_update_pending = false;
+        return true;
+    }
+
+    return false;
+}
@@ -1091,14 +1091,31 @@ int pcapping_protocol_process_fwk_notification(
     const struct fwk_event *fwk_notification_event)
 {
     struct mod_scmi_power_capping_domain_context *domain_ctx;
+    const struct mod_power_allocator_notification_params *cap_params;
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+    const struct mod_power_meter_notification_params *measurements_params;
+#endif
 
     unsigned int domain_idx =
         fwk_id_get_element_idx(fwk_notification_event->target_id);
 
     domain_ctx = get_domain_ctx(domain_idx);
 
+    /*
+     * The power allocator and the power meter notify every domain from their
+     * module identifier, so only handle the notifications about the devices
+     * of this domain.
+     */
     if (fwk_id_is_equal(
             fwk_notification_event->id, pcapping_protocol_cap_notification)) {
+        cap_params = (const struct mod_power_allocator_notification_params *)
+                         fwk_notification_event->params;
+        if (!fwk_id_is_equal(
+                cap_params->domain_id,
+                domain_ctx->config->power_allocator_domain_id)) {
+            return FWK_SUCCESS;
+        }
+
         return pcapping_protocol_process_cap_fwk_notification(
             domain_idx, domain_ctx);
     }
@@ -1111,6 +1128,15 @@ int pcapping_protocol_process_fwk_notification(
     if (fwk_id_is_equal(
             fwk_notification_event->id,
             pcapping_protocol_power_measurements_notification)) {
+        measurements_params =
+            (const struct mod_power_meter_notification_params *)
+                fwk_notification_event->params;
+        if (!fwk_id_is_equal(
+                measurements_params->id,
+                domain_ctx->config->power_meter_domain_id)) {
+            return FWK_SUCCESS;
+        }
+
         return pcapping_protocol_process_power_measurements_fwk_notification(
             domain_idx, domain_ctx);
     }
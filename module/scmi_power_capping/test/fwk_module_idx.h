@@ -22,6 +22,9 @@ enum fwk_module_idx {
 #endif
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     FWK_MODULE_IDX_RESOURCE_PERMS,
+#endif
+#ifdef BUILD_HAS_SCMI_POWER_CAPPING_BURST
+    FWK_MODULE_IDX_TIMER,
 #endif
     FWK_MODULE_IDX_COUNT,
 };
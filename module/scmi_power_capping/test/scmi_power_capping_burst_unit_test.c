@@ -0,0 +1,394 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "string.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockmod_power_allocator_extra.h>
+#include <Mockmod_power_coordinator_extra.h>
+#include <Mockmod_power_meter_extra.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_scmi_power_capping_unit_test.h>
+
+#include <stdarg.h>
+
+#include UNIT_TEST_SRC
+
+#define TEST_REQUESTED_CAP    (50u)
+#define TEST_BURST_POWER_CAP  (80u)
+#define TEST_BURST_WINDOW     (20u)
+#define TEST_PEAK_POWER_CAP   (120u)
+#define TEST_FLOOR_POWER_CAP  (20u)
+#define TEST_SAMPLE_PERIOD    (10u)
+#define TEST_PAI              (100000u)
+#define TEST_AVG(POWER)       ((uint64_t)(POWER) << PCAPPING_BURST_AVG_SHIFT)
+
+static int status;
+
+static const struct mod_power_allocator_api power_allocator_api = {
+    .get_cap = get_cap,
+    .set_cap = set_cap,
+};
+
+static const struct mod_power_coordinator_api power_coordinator_api = {
+    .get_coordinator_period = get_coordinator_period,
+    .set_coordinator_period = set_coordinator_period,
+};
+
+static const struct mod_power_meter_api power_meter_api = {
+    .get_power = get_power,
+};
+
+static struct mod_scmi_power_capping_power_apis power_management_apis;
+
+static const struct mod_scmi_power_capping_burst_config burst_config = {
+    .burst_power_cap = TEST_BURST_POWER_CAP,
+    .burst_window = TEST_BURST_WINDOW,
+    .peak_power_cap = TEST_PEAK_POWER_CAP,
+    .floor_power_cap = TEST_FLOOR_POWER_CAP,
+    .sample_period = TEST_SAMPLE_PERIOD,
+};
+
+static const struct mod_scmi_power_capping_domain_config
+    scmi_power_capping_burst_config = {
+        .power_allocator_domain_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_POWER_ALLOCATOR, 0),
+        .power_coordinator_domain_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_POWER_COORDINATOR, 0),
+        .power_meter_domain_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_POWER_METER, 0),
+        .burst_config = &burst_config,
+    };
+
+static const struct mod_scmi_power_capping_domain_config
+    scmi_power_capping_burst_config_2 = {
+        .power_allocator_domain_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_POWER_ALLOCATOR, 1),
+        .burst_config = &burst_config,
+    };
+
+static const struct mod_scmi_power_capping_domain_config
+    scmi_power_capping_default_config = {
+        .power_allocator_domain_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_POWER_ALLOCATOR, 1),
+    };
+
+static struct mod_scmi_power_capping_domain_context
+    domain_ctx_table[FAKE_POWER_CAPPING_IDX_COUNT];
+
+static struct pcapping_burst_ctx burst_ctx_table[FAKE_POWER_CAPPING_IDX_COUNT];
+
+/* Helper functions */
+static void test_expect_long_ratio(void)
+{
+    uint32_t pai = TEST_PAI;
+
+    get_coordinator_period_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    get_coordinator_period_ReturnThruPtr_period(&pai);
+}
+
+/* Test functions */
+/* Initialize the tests */
+void setUp(void)
+{
+    memset(domain_ctx_table, 0u, sizeof(domain_ctx_table));
+    memset(burst_ctx_table, 0u, sizeof(burst_ctx_table));
+
+    domain_ctx_table[FAKE_POWER_CAPPING_IDX_1].config =
+        &scmi_power_capping_burst_config;
+    domain_ctx_table[FAKE_POWER_CAPPING_IDX_2].config =
+        &scmi_power_capping_default_config;
+    burst_ctx_table[FAKE_POWER_CAPPING_IDX_1].config = &burst_config;
+
+    pcapping_burst_global_ctx.power_capping_domain_ctx_table = domain_ctx_table;
+    pcapping_burst_global_ctx.burst_ctx_table = burst_ctx_table;
+    pcapping_burst_global_ctx.domain_count = FAKE_POWER_CAPPING_IDX_COUNT;
+
+    power_management_apis.power_allocator_api = &power_allocator_api;
+    power_management_apis.power_coordinator_api = &power_coordinator_api;
+    power_management_apis.power_meter_api = &power_meter_api;
+    pcapping_burst_set_power_apis(&power_management_apis);
+}
+
+void tearDown(void)
+{
+    Mockmod_power_allocator_extra_Verify();
+    Mockmod_power_coordinator_extra_Verify();
+    Mockmod_power_meter_extra_Verify();
+    Mockfwk_id_Verify();
+}
+
+void utest_pcapping_burst_set_power_apis(void)
+{
+    TEST_ASSERT_EQUAL_PTR(
+        &pcapping_burst_power_allocator_api,
+        power_management_apis.power_allocator_api);
+    TEST_ASSERT_EQUAL_PTR(
+        &power_allocator_api, pcapping_burst_global_ctx.power_allocator_api);
+}
+
+void utest_pcapping_burst_set_domain_config_invalid(void)
+{
+    struct mod_scmi_power_capping_burst_config invalid_burst_config =
+        burst_config;
+    struct mod_scmi_power_capping_domain_config config =
+        scmi_power_capping_burst_config;
+
+    config.burst_config = &invalid_burst_config;
+    invalid_burst_config.burst_window = TEST_SAMPLE_PERIOD - 1u;
+
+    status = pcapping_burst_set_domain_config(FAKE_POWER_CAPPING_IDX_1, &config);
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+
+    status = pcapping_burst_set_domain_config(
+        FAKE_POWER_CAPPING_IDX_COUNT, &scmi_power_capping_burst_config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void utest_pcapping_burst_set_cap_no_burst(void)
+{
+    fwk_id_t allocator_id =
+        scmi_power_capping_default_config.power_allocator_domain_id;
+
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    set_cap_ExpectAndReturn(allocator_id, TEST_REQUESTED_CAP, FWK_SUCCESS);
+
+    status = power_management_apis.power_allocator_api->set_cap(
+        allocator_id, TEST_REQUESTED_CAP);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void utest_pcapping_burst_set_cap_sprint(void)
+{
+    uint32_t cap;
+    fwk_id_t allocator_id =
+        scmi_power_capping_burst_config.power_allocator_domain_id;
+
+    /* An idle domain can sprint up to the peak power cap */
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    test_expect_long_ratio();
+    set_cap_ExpectAndReturn(allocator_id, TEST_PEAK_POWER_CAP, FWK_SUCCESS);
+
+    status = power_management_apis.power_allocator_api->set_cap(
+        allocator_id, TEST_REQUESTED_CAP);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(
+        TEST_PEAK_POWER_CAP,
+        burst_ctx_table[FAKE_POWER_CAPPING_IDX_1].applied_cap);
+
+    /* The agents are reported the requested cap */
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+
+    status = power_management_apis.power_allocator_api->get_cap(
+        allocator_id, &cap);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(TEST_REQUESTED_CAP, cap);
+}
+
+void utest_pcapping_burst_set_cap_disable(void)
+{
+    fwk_id_t allocator_id =
+        scmi_power_capping_burst_config.power_allocator_domain_id;
+
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    set_cap_ExpectAndReturn(allocator_id, DISABLE_CAP_VALUE, FWK_PENDING);
+
+    status = power_management_apis.power_allocator_api->set_cap(
+        allocator_id, DISABLE_CAP_VALUE);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_FALSE(burst_ctx_table[FAKE_POWER_CAPPING_IDX_1].active);
+    TEST_ASSERT_TRUE(
+        burst_ctx_table[FAKE_POWER_CAPPING_IDX_1].agent_update_pending);
+}
+
+void utest_pcapping_burst_process_sample_payback(void)
+{
+    uint32_t power = 100u;
+    uint32_t domain_idx = FAKE_POWER_CAPPING_IDX_1;
+    struct fwk_event event = { 0 };
+    struct pcapping_burst_ctx *burst_ctx = &burst_ctx_table[domain_idx];
+
+    burst_ctx->active = true;
+    burst_ctx->requested_cap = TEST_REQUESTED_CAP;
+    burst_ctx->applied_cap = TEST_PEAK_POWER_CAP;
+    burst_ctx->long_avg = TEST_AVG(TEST_REQUESTED_CAP);
+    burst_ctx->short_avg = TEST_AVG(TEST_REQUESTED_CAP);
+    *(uint32_t *)event.params = domain_idx;
+
+    get_power_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    get_power_ReturnThruPtr_power(&power);
+    test_expect_long_ratio();
+
+    /* The budget of the PAI is exceeded, the domain is held to the floor */
+    set_cap_ExpectAndReturn(
+        scmi_power_capping_burst_config.power_allocator_domain_id,
+        TEST_FLOOR_POWER_CAP,
+        FWK_PENDING);
+
+    status = pcapping_burst_process_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(TEST_AVG(55u), burst_ctx->long_avg);
+    TEST_ASSERT_EQUAL(TEST_AVG(75u), burst_ctx->short_avg);
+    TEST_ASSERT_EQUAL(TEST_FLOOR_POWER_CAP, burst_ctx->applied_cap);
+    TEST_ASSERT_TRUE(burst_ctx->internal_update_pending);
+
+    /* No further adjustment until the pending one has been applied */
+    get_power_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    get_power_ReturnThruPtr_power(&power);
+    test_expect_long_ratio();
+
+    status = pcapping_burst_process_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void utest_pcapping_burst_process_sample_inactive(void)
+{
+    uint32_t power = 100u;
+    struct fwk_event event = { 0 };
+    struct pcapping_burst_ctx *burst_ctx =
+        &burst_ctx_table[FAKE_POWER_CAPPING_IDX_1];
+
+    *(uint32_t *)event.params = FAKE_POWER_CAPPING_IDX_1;
+
+    get_power_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    get_power_ReturnThruPtr_power(&power);
+    test_expect_long_ratio();
+
+    status = pcapping_burst_process_event(&event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(TEST_AVG(10u), burst_ctx->long_avg);
+    TEST_ASSERT_EQUAL(TEST_AVG(50u), burst_ctx->short_avg);
+}
+
+void utest_pcapping_burst_process_sample_invalid_domain(void)
+{
+    struct fwk_event event = { 0 };
+
+    *(uint32_t *)event.params = FAKE_POWER_CAPPING_IDX_COUNT;
+
+    status = pcapping_burst_process_event(&event);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+static void test_expect_filter_domain(
+    const struct fwk_event *event,
+    unsigned int domain_idx,
+    bool match)
+{
+    const struct mod_power_allocator_notification_params *params =
+        (const struct mod_power_allocator_notification_params *)event->params;
+
+    fwk_id_is_equal_ExpectAndReturn(
+        event->id, pcapping_burst_cap_notification, true);
+    fwk_id_get_element_idx_ExpectAndReturn(event->target_id, domain_idx);
+    fwk_id_is_equal_ExpectAndReturn(
+        domain_ctx_table[domain_idx].config->power_allocator_domain_id,
+        params->domain_id,
+        match);
+}
+
+void utest_pcapping_burst_filter_fwk_notification(void)
+{
+    struct fwk_event event = {
+        .id = pcapping_burst_cap_notification,
+        .target_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_SCMI_POWER_CAPPING, FAKE_POWER_CAPPING_IDX_1),
+    };
+    struct mod_power_allocator_notification_params *params =
+        (struct mod_power_allocator_notification_params *)event.params;
+    struct pcapping_burst_ctx *burst_ctx =
+        &burst_ctx_table[FAKE_POWER_CAPPING_IDX_1];
+
+    params->domain_id =
+        scmi_power_capping_burst_config.power_allocator_domain_id;
+
+    burst_ctx->agent_update_pending = true;
+    burst_ctx->internal_update_pending = true;
+
+    /* The cap requested by the agent is notified first */
+    test_expect_filter_domain(&event, FAKE_POWER_CAPPING_IDX_1, true);
+    TEST_ASSERT_FALSE(pcapping_burst_filter_fwk_notification(&event));
+
+    test_expect_filter_domain(&event, FAKE_POWER_CAPPING_IDX_1, true);
+    TEST_ASSERT_TRUE(pcapping_burst_filter_fwk_notification(&event));
+
+    test_expect_filter_domain(&event, FAKE_POWER_CAPPING_IDX_1, true);
+    TEST_ASSERT_FALSE(pcapping_burst_filter_fwk_notification(&event));
+}
+
+void utest_pcapping_burst_filter_fwk_notification_two_domains(void)
+{
+    struct fwk_event event_1 = {
+        .id = pcapping_burst_cap_notification,
+        .target_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_SCMI_POWER_CAPPING, FAKE_POWER_CAPPING_IDX_1),
+    };
+    struct fwk_event event_2 = {
+        .id = pcapping_burst_cap_notification,
+        .target_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_SCMI_POWER_CAPPING, FAKE_POWER_CAPPING_IDX_2),
+    };
+    struct pcapping_burst_ctx *burst_ctx_1 =
+        &burst_ctx_table[FAKE_POWER_CAPPING_IDX_1];
+    struct pcapping_burst_ctx *burst_ctx_2 =
+        &burst_ctx_table[FAKE_POWER_CAPPING_IDX_2];
+
+    domain_ctx_table[FAKE_POWER_CAPPING_IDX_2].config =
+        &scmi_power_capping_burst_config_2;
+    burst_ctx_2->config = &burst_config;
+
+    /* The same notification is delivered to both domains */
+    ((struct mod_power_allocator_notification_params *)event_1.params)
+        ->domain_id =
+        scmi_power_capping_burst_config_2.power_allocator_domain_id;
+    ((struct mod_power_allocator_notification_params *)event_2.params)
+        ->domain_id =
+        scmi_power_capping_burst_config_2.power_allocator_domain_id;
+
+    burst_ctx_1->agent_update_pending = true;
+    burst_ctx_1->internal_update_pending = true;
+    burst_ctx_2->internal_update_pending = true;
+
+    /* The first domain ignores the cap change of the second domain */
+    test_expect_filter_domain(&event_1, FAKE_POWER_CAPPING_IDX_1, false);
+    TEST_ASSERT_FALSE(pcapping_burst_filter_fwk_notification(&event_1));
+    TEST_ASSERT_TRUE(burst_ctx_1->agent_update_pending);
+    TEST_ASSERT_TRUE(burst_ctx_1->internal_update_pending);
+
+    /* The second domain filters out its own internal update */
+    test_expect_filter_domain(&event_2, FAKE_POWER_CAPPING_IDX_2, true);
+    TEST_ASSERT_TRUE(pcapping_burst_filter_fwk_notification(&event_2));
+    TEST_ASSERT_FALSE(burst_ctx_2->internal_update_pending);
+}
+
+int scmi_power_capping_burst_test_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(utest_pcapping_burst_set_power_apis);
+    RUN_TEST(utest_pcapping_burst_set_domain_config_invalid);
+    RUN_TEST(utest_pcapping_burst_set_cap_no_burst);
+    RUN_TEST(utest_pcapping_burst_set_cap_sprint);
+    RUN_TEST(utest_pcapping_burst_set_cap_disable);
+    RUN_TEST(utest_pcapping_burst_process_sample_payback);
+    RUN_TEST(utest_pcapping_burst_process_sample_inactive);
+    RUN_TEST(utest_pcapping_burst_process_sample_invalid_domain);
+    RUN_TEST(utest_pcapping_burst_filter_fwk_notification);
+    RUN_TEST(utest_pcapping_burst_filter_fwk_notification_two_domains);
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_power_capping_burst_test_main();
+}
+#endif
@@ -1353,6 +1353,13 @@ void utest_pcapping_protocol_process_notification(void)
             FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI_POWER_CAPPING, element_idx),
     };
 
+    struct mod_power_allocator_notification_params *params =
+        (struct mod_power_allocator_notification_params *)
+            notification_event.params;
+
+    params->domain_id =
+        scmi_power_capping_default_config.power_allocator_domain_id;
+
     domain_ctx_table[element_idx].cap_pending_service_id = service_id_1;
 
     struct scmi_power_capping_cap_set_p2a ret_payload = {
@@ -1364,6 +1371,10 @@ void utest_pcapping_protocol_process_notification(void)
 
     fwk_id_is_equal_ExpectAndReturn(
         notification_event.id, pcapping_protocol_cap_notification, true);
+    fwk_id_is_equal_ExpectAndReturn(
+        params->domain_id,
+        scmi_power_capping_default_config.power_allocator_domain_id,
+        true);
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
@@ -1381,6 +1392,85 @@ void utest_pcapping_protocol_process_notification(void)
         FWK_ID_NONE.value);
 }
 
+void utest_pcapping_protocol_process_notification_other_domain(void)
+{
+    int status;
+    const unsigned int element_idx = 0u;
+
+    struct fwk_event notification_event = {
+        .id = pcapping_protocol_cap_notification,
+        .target_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI_POWER_CAPPING, element_idx),
+    };
+
+    struct mod_power_allocator_notification_params *params =
+        (struct mod_power_allocator_notification_params *)
+            notification_event.params;
+
+    params->domain_id = scmi_power_capping_config_1.power_allocator_domain_id;
+
+    domain_ctx_table[element_idx].cap_pending_service_id = service_id_1;
+
+    fwk_id_get_element_idx_ExpectAndReturn(
+        notification_event.target_id, element_idx);
+
+    fwk_id_is_equal_ExpectAndReturn(
+        notification_event.id, pcapping_protocol_cap_notification, true);
+    fwk_id_is_equal_ExpectAndReturn(
+        params->domain_id,
+        scmi_power_capping_default_config.power_allocator_domain_id,
+        false);
+
+    status = pcapping_protocol_process_fwk_notification(&notification_event);
+
+    /* The pending request of this domain is left untouched */
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        domain_ctx_table[element_idx].cap_pending_service_id.value,
+        service_id_1.value);
+}
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+void utest_pcapping_protocol_process_measurements_notification_other_domain(
+    void)
+{
+    int status;
+    const unsigned int element_idx = 0u;
+
+    struct fwk_event notification_event = {
+        .id = pcapping_protocol_power_measurements_notification,
+        .target_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI_POWER_CAPPING, element_idx),
+    };
+
+    struct mod_power_meter_notification_params *params =
+        (struct mod_power_meter_notification_params *)notification_event.params;
+
+    params->id = FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_METER, 1);
+
+    fwk_id_get_element_idx_ExpectAndReturn(
+        notification_event.target_id, element_idx);
+
+    fwk_id_is_equal_ExpectAndReturn(
+        notification_event.id, pcapping_protocol_cap_notification, false);
+    fwk_id_is_equal_ExpectAndReturn(
+        notification_event.id, pcapping_protocol_pai_notification, false);
+    fwk_id_is_equal_ExpectAndReturn(
+        notification_event.id,
+        pcapping_protocol_power_measurements_notification,
+        true);
+    fwk_id_is_equal_ExpectAndReturn(
+        params->id,
+        scmi_power_capping_default_config.power_meter_domain_id,
+        false);
+
+    /* No SCMI notification is queued for this domain */
+    status = pcapping_protocol_process_fwk_notification(&notification_event);
+
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+}
+#endif
+
 void utest_pcapping_protocol_process_bind_request_success(void)
 {
     int status;
@@ -1466,6 +1556,11 @@ int scmi_power_capping_protocol_test_main(void)
     RUN_TEST(utest_pcapping_protocol_start_module);
     RUN_TEST(utest_pcapping_protocol_start_element);
     RUN_TEST(utest_pcapping_protocol_process_notification);
+    RUN_TEST(utest_pcapping_protocol_process_notification_other_domain);
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+    RUN_TEST(
+        utest_pcapping_protocol_process_measurements_notification_other_domain);
+#endif
     RUN_TEST(utest_pcapping_protocol_process_bind_request_success);
     RUN_TEST(utest_pcapping_protocol_process_bind_request_failure);
     return UNITY_END();
@@ -84,6 +84,35 @@ struct scmi_reset_domain_request_p2a {
     int32_t status;
 };
 
+/*
+ * RESET_REQUEST_BATCH
+ *
+ * Platform-specific extension issuing the same reset request on several
+ * domains with a single message. Domains are processed in order and
+ * processing stops at the first domain that fails, the number of domains
+ * processed being returned along with the status of the failure.
+ *
+ * When asynchronous resets are requested, the completion of the whole batch
+ * is signalled to the agent by a single RESET_BATCH_COMPLETE notification,
+ * sent right after the response when none of the resets is pending. No
+ * notification is sent for a batch that failed.
+ */
+
+#define SCMI_RESET_DOMAIN_REQUEST_BATCH UINT32_C(0x80)
+#define SCMI_RESET_DOMAIN_BATCH_COMPLETE UINT32_C(0x80)
+
+struct scmi_reset_domain_request_batch_a2p {
+    uint32_t flags;
+    uint32_t reset_state;
+    uint32_t domain_count;
+    uint32_t domain_ids[];
+};
+
+struct scmi_reset_domain_request_batch_p2a {
+    int32_t status;
+    uint32_t domain_count;
+};
+
 /*
  * RESET_NOTIFY
  */
@@ -119,6 +148,15 @@ struct scmi_reset_domain_issued_p2a {
     uint32_t reset_state;
 };
 
+/*
+ * RESET_BATCH_COMPLETE
+ */
+
+struct scmi_reset_domain_batch_complete_p2a {
+    uint32_t agent_id;
+    uint32_t domain_count;
+};
+
 /*!
  * \}
  */
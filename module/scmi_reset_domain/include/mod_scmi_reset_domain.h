@@ -93,6 +93,14 @@ struct mod_scmi_reset_domain_config {
     /*! Number of agents in ::mod_scmi_reset_domain_config::agent_table */
     unsigned int agent_count;
 
+    /*!
+     * \brief Maximum number of domains in a batched reset request.
+     *
+     * \details Batched reset requests let an agent reset several domains with
+     *      a single message and be notified once when all of them completed.
+     *      Zero disables the batched reset request command.
+     */
+    unsigned int batch_domain_count_max;
 };
 
 /*!
@@ -34,6 +34,27 @@
 #    define MOD_SCMI_RESET_DOMAIN_NOTIFICATION_COUNT 1
 #endif
 
+/*
+ * Cookie flag set on the resets issued as part of an asynchronous batch, the
+ * rest of the cookie being the identifier of the requesting agent.
+ */
+#define SCMI_RESET_DOMAIN_BATCH_COOKIE ((uintptr_t)1 << 31)
+
+/* Batched reset request context, one per agent */
+struct scmi_rd_batch_ctx {
+    /* Service the batch was requested on */
+    fwk_id_t service_id;
+
+    /* Number of domains in the batch */
+    uint32_t domain_count;
+
+    /* Number of asynchronous resets of the batch not completed yet */
+    uint32_t pending_count;
+
+    /* The batch failed, its completion is not signalled */
+    bool failed;
+};
+
 struct scmi_rd_ctx {
     /*! SCMI Reset Module Configuration */
     const struct mod_scmi_reset_domain_config *config;
@@ -45,6 +66,9 @@ struct scmi_rd_ctx {
     /*! Number of reset domains available on platform */
     uint8_t plat_reset_domain_count;
 
+    /*! Table of batched reset request contexts, indexed by agent */
+    struct scmi_rd_batch_ctx *batch_ctx_table;
+
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     /*! SCMI notification_id */
     fwk_id_t notification_id;
@@ -73,6 +97,7 @@ static int reset_request_handler(fwk_id_t service_id,
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
 static int reset_notify_handler(fwk_id_t service_id,
                                 const uint32_t *payload);
+static void scmi_reset_batch_notify(unsigned int agent_id);
 #endif
 
 /*
@@ -155,8 +180,10 @@ static int protocol_message_attributes_handler(fwk_id_t service_id,
 
     params = *(const struct scmi_protocol_message_attributes_a2p *)payload;
 
-    if ((params.message_id < FWK_ARRAY_SIZE(msg_handler_table)) &&
-        (msg_handler_table[params.message_id] != NULL)) {
+    if (((params.message_id < FWK_ARRAY_SIZE(msg_handler_table)) &&
+         (msg_handler_table[params.message_id] != NULL)) ||
+        ((params.message_id == SCMI_RESET_DOMAIN_REQUEST_BATCH) &&
+         (scmi_rd_ctx.batch_ctx_table != NULL))) {
         outmsg.status = (int32_t)SCMI_SUCCESS;
         outmsg_size = sizeof(outmsg);
     }
@@ -292,55 +319,52 @@ exit:
     return status;
 }
 
-static int reset_request_handler(fwk_id_t service_id,
-                                 const uint32_t *payload)
+/*
+ * Validate and issue a reset request on a domain on behalf of an agent. The
+ * status to return to the agent is written to scmi_status and issued is set
+ * when the request has been passed to the reset domain HAL.
+ */
+static int reset_domain_request(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    uint32_t domain_id,
+    uint32_t flags,
+    uint32_t reset_state,
+    uintptr_t cookie,
+    int32_t *scmi_status,
+    bool *issued)
 {
-    int status, respond_status;
-    unsigned int agent_id;
+    int status;
     struct mod_reset_domain_dev_config *reset_dev_config;
-    struct scmi_reset_domain_request_a2p params = { 0 };
-    struct scmi_reset_domain_request_p2a outmsg = {
-        .status = (int32_t)SCMI_NOT_FOUND
-    };
     enum mod_reset_domain_mode mode = MOD_RESET_DOMAIN_MODE_EXPLICIT_DEASSERT;
-
-    size_t outmsg_size = sizeof(outmsg.status);
     const struct mod_reset_domain_api *reset_api = scmi_rd_ctx.reset_api;
     const struct mod_scmi_reset_domain_device *reset_device = NULL;
     enum mod_scmi_reset_domain_policy_status policy_status;
-    uint32_t reset_state;
 
-    params = *(const struct scmi_reset_domain_request_a2p *)payload;
+    *scmi_status = (int32_t)SCMI_NOT_FOUND;
+    *issued = false;
 
-    if ((params.flags & ~SCMI_RESET_DOMAIN_FLAGS_MASK) != 0) {
-        status = FWK_SUCCESS;
-        outmsg.status = (int32_t)SCMI_INVALID_PARAMETERS;
-        goto exit;
+    if ((flags & ~SCMI_RESET_DOMAIN_FLAGS_MASK) != 0) {
+        *scmi_status = (int32_t)SCMI_INVALID_PARAMETERS;
+        return FWK_SUCCESS;
     }
 
     /**
      * Verify that the reset state ID is 0 when the reset
      * state type is Architectural.
      */
-    if (((params.reset_state & SCMI_RESET_DOMAIN_RESET_STATE_TYPE_MASK) == 0) &&
-        ((params.reset_state & SCMI_RESET_DOMAIN_RESET_STATE_ID_MASK) != 0)) {
-        status = FWK_SUCCESS;
-        outmsg.status = (int32_t)SCMI_INVALID_PARAMETERS;
-        goto exit;
+    if (((reset_state & SCMI_RESET_DOMAIN_RESET_STATE_TYPE_MASK) == 0) &&
+        ((reset_state & SCMI_RESET_DOMAIN_RESET_STATE_ID_MASK) != 0)) {
+        *scmi_status = (int32_t)SCMI_INVALID_PARAMETERS;
+        return FWK_SUCCESS;
     }
 
-    status = scmi_rd_ctx.scmi_api->get_agent_id(service_id, &agent_id);
-    if (status != FWK_SUCCESS)
-        goto exit;
-
-    if (params.domain_id >= scmi_rd_ctx.plat_reset_domain_count) {
-        status = FWK_E_PARAM;
-        goto exit;
-    }
+    if (domain_id >= scmi_rd_ctx.plat_reset_domain_count)
+        return FWK_E_PARAM;
 
-    status = get_reset_device(service_id, params.domain_id, &reset_device);
+    status = get_reset_device(service_id, domain_id, &reset_device);
     if (status != FWK_SUCCESS)
-        goto exit;
+        return status;
 
     reset_dev_config = (struct mod_reset_domain_dev_config *)
                        fwk_module_get_data(reset_device->element_id);
@@ -352,17 +376,17 @@ static int reset_request_handler(fwk_id_t service_id,
      *       b010 Explicit reset request.
      *       b101 Auto Reset Async.
      */
-    if (!(params.flags & SCMI_RESET_DOMAIN_AUTO)) {
+    if (!(flags & SCMI_RESET_DOMAIN_AUTO)) {
         /* If auto reset is not requested then check if device supports explicit
          * assert/de-assert reset.
          */
         if (!(reset_dev_config->modes &
             (MOD_RESET_DOMAIN_MODE_EXPLICIT_ASSERT |
             MOD_RESET_DOMAIN_MODE_EXPLICIT_DEASSERT))) {
-            outmsg.status = (int32_t)SCMI_NOT_SUPPORTED;
-            goto exit;
+            *scmi_status = (int32_t)SCMI_NOT_SUPPORTED;
+            return FWK_SUCCESS;
         } else {
-           if (params.flags & SCMI_RESET_DOMAIN_EXPLICIT)
+           if (flags & SCMI_RESET_DOMAIN_EXPLICIT)
                mode = MOD_RESET_DOMAIN_MODE_EXPLICIT_ASSERT;
         }
     } else {
@@ -370,12 +394,12 @@ static int reset_request_handler(fwk_id_t service_id,
     }
 
     /* Handle async reset request. */
-    if (params.flags & SCMI_RESET_DOMAIN_ASYNC) {
+    if (flags & SCMI_RESET_DOMAIN_ASYNC) {
         /* Async reset request is valid only in auto reset mode
          */
-        if (!(params.flags & SCMI_RESET_DOMAIN_AUTO)) {
-            outmsg.status = (int32_t)SCMI_INVALID_PARAMETERS;
-            goto exit;
+        if (!(flags & SCMI_RESET_DOMAIN_AUTO)) {
+            *scmi_status = (int32_t)SCMI_INVALID_PARAMETERS;
+            return FWK_SUCCESS;
         }
 
         /* Return not supported as associated device does not support
@@ -383,48 +407,168 @@ static int reset_request_handler(fwk_id_t service_id,
          */
         if (!(reset_dev_config->modes &
             MOD_RESET_DOMAIN_MODE_AUTO_RESET_ASYNC)) {
-            outmsg.status = (int32_t)SCMI_NOT_SUPPORTED;
-            goto exit;
+            *scmi_status = (int32_t)SCMI_NOT_SUPPORTED;
+            return FWK_SUCCESS;
         } else {
             mode |= MOD_RESET_DOMAIN_MODE_AUTO_RESET_ASYNC;
         }
     }
 
-    reset_state = params.reset_state;
     status = scmi_reset_domain_reset_request_policy(&policy_status,
-        &mode, &reset_state, agent_id, params.domain_id);
+        &mode, &reset_state, agent_id, domain_id);
 
     if (status != FWK_SUCCESS) {
-        outmsg.status = (int32_t)SCMI_GENERIC_ERROR;
-        goto exit;
+        *scmi_status = (int32_t)SCMI_GENERIC_ERROR;
+        return status;
     }
     if (policy_status == MOD_SCMI_RESET_DOMAIN_SKIP_MESSAGE_HANDLER) {
-        outmsg.status = (int32_t)SCMI_SUCCESS;
-        goto exit;
+        *scmi_status = (int32_t)SCMI_SUCCESS;
+        return FWK_SUCCESS;
     }
 
-    outmsg.status = (int32_t)SCMI_NOT_SUPPORTED;
+    *scmi_status = (int32_t)SCMI_NOT_SUPPORTED;
     status = reset_api->set_reset_state(reset_device->element_id,
                                         mode,
                                         reset_state,
-                                        (uintptr_t)agent_id);
+                                        cookie);
     if (status != FWK_SUCCESS) {
         if (status == FWK_E_STATE)
-            outmsg.status = (int32_t)SCMI_HARDWARE_ERROR;
+            *scmi_status = (int32_t)SCMI_HARDWARE_ERROR;
+        return status;
+    }
+
+    *scmi_status = (int32_t)SCMI_SUCCESS;
+    *issued = true;
+
+    return FWK_SUCCESS;
+}
+
+static int reset_request_handler(fwk_id_t service_id,
+                                 const uint32_t *payload)
+{
+    int status, respond_status;
+    unsigned int agent_id;
+    struct scmi_reset_domain_request_a2p params = { 0 };
+    struct scmi_reset_domain_request_p2a outmsg = {
+        .status = (int32_t)SCMI_NOT_FOUND
+    };
+    bool issued;
+
+    params = *(const struct scmi_reset_domain_request_a2p *)payload;
+
+    status = scmi_rd_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS)
         goto exit;
+
+    status = reset_domain_request(
+        service_id,
+        agent_id,
+        params.domain_id,
+        params.flags,
+        params.reset_state,
+        (uintptr_t)agent_id,
+        &outmsg.status,
+        &issued);
+
+exit:
+    respond_status =
+        scmi_rd_ctx.scmi_api->respond(service_id, &outmsg, sizeof(outmsg));
+
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-RESET] %s @%d", __func__, __LINE__);
     }
 
-    outmsg.status = (int32_t)SCMI_SUCCESS;
-    outmsg_size = sizeof(outmsg);
+    return status;
+}
+
+static int reset_request_batch_handler(
+    fwk_id_t service_id,
+    const struct scmi_reset_domain_request_batch_a2p *params)
+{
+    int status, respond_status;
+    unsigned int agent_id;
+    uint32_t domain_idx;
+    uintptr_t cookie;
+    bool async, issued;
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+    bool notify = false;
+#endif
+    struct scmi_rd_batch_ctx *batch_ctx;
+    struct scmi_reset_domain_request_batch_p2a outmsg = {
+        .status = (int32_t)SCMI_NOT_FOUND,
+    };
+
+    status = get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS)
+        goto exit;
+
+    batch_ctx = &scmi_rd_ctx.batch_ctx_table[agent_id];
+
+    /* Only one asynchronous batch per agent can be in flight */
+    if (batch_ctx->pending_count != 0) {
+        outmsg.status = (int32_t)SCMI_BUSY;
+        goto exit;
+    }
+
+    async = ((params->flags & SCMI_RESET_DOMAIN_ASYNC) != 0);
+
+#if !defined(BUILD_HAS_SCMI_NOTIFICATIONS) || !defined(BUILD_HAS_NOTIFICATION)
+    /* The completion of the batch could not be signalled */
+    if (async) {
+        outmsg.status = (int32_t)SCMI_NOT_SUPPORTED;
+        goto exit;
+    }
+#endif
+
+    cookie = (uintptr_t)agent_id;
+    if (async)
+        cookie |= SCMI_RESET_DOMAIN_BATCH_COOKIE;
+
+    /*
+     * Completions are delivered as notifications, so none of them can be
+     * processed before the pending count has been set below.
+     */
+    for (domain_idx = 0; domain_idx < params->domain_count; domain_idx++) {
+        status = reset_domain_request(
+            service_id,
+            agent_id,
+            params->domain_ids[domain_idx],
+            params->flags,
+            params->reset_state,
+            cookie,
+            &outmsg.status,
+            &issued);
+        if ((status != FWK_SUCCESS) || (outmsg.status != SCMI_SUCCESS))
+            break;
+
+        outmsg.domain_count++;
+        if (async && issued)
+            batch_ctx->pending_count++;
+    }
+
+    batch_ctx->service_id = service_id;
+    batch_ctx->domain_count = outmsg.domain_count;
+    batch_ctx->failed =
+        (status != FWK_SUCCESS) || (outmsg.status != (int32_t)SCMI_SUCCESS);
+
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+    /* No reset left to complete, the batch completes with the response */
+    notify = async && !batch_ctx->failed && (batch_ctx->pending_count == 0);
+#endif
 
 exit:
     respond_status =
-        scmi_rd_ctx.scmi_api->respond(service_id, &outmsg, outmsg_size);
+        scmi_rd_ctx.scmi_api->respond(service_id, &outmsg, sizeof(outmsg));
 
     if (respond_status != FWK_SUCCESS) {
         FWK_LOG_DEBUG("[SCMI-RESET] %s @%d", __func__, __LINE__);
     }
 
+#ifdef BUILD_HAS_SCMI_NOTIFICATIONS
+    if (notify)
+        scmi_reset_batch_notify(agent_id);
+#endif
+
     return status;
 }
 
@@ -489,6 +633,49 @@ exit:
     return status;
 }
 
+/* Signal the completion of the batch of an agent */
+static void scmi_reset_batch_notify(unsigned int agent_id)
+{
+    const struct scmi_rd_batch_ctx *batch_ctx;
+    struct scmi_reset_domain_batch_complete_p2a batch_complete;
+
+    batch_ctx = &scmi_rd_ctx.batch_ctx_table[agent_id];
+
+    batch_complete.agent_id = (uint32_t)agent_id;
+    batch_complete.domain_count = batch_ctx->domain_count;
+
+    /* Only the agent which requested the batch is notified */
+    scmi_rd_ctx.scmi_api->notify(
+        batch_ctx->service_id,
+        (int)MOD_SCMI_PROTOCOL_ID_RESET_DOMAIN,
+        (int)SCMI_RESET_DOMAIN_BATCH_COMPLETE,
+        &batch_complete,
+        sizeof(batch_complete));
+}
+
+static void scmi_reset_batch_complete(unsigned int agent_id)
+{
+    struct scmi_rd_batch_ctx *batch_ctx;
+
+    if ((scmi_rd_ctx.batch_ctx_table == NULL) ||
+        (agent_id >= scmi_rd_ctx.config->agent_count))
+        return;
+
+    batch_ctx = &scmi_rd_ctx.batch_ctx_table[agent_id];
+    if (batch_ctx->pending_count == 0)
+        return;
+
+    batch_ctx->pending_count--;
+    if (batch_ctx->pending_count != 0)
+        return;
+
+    /* The agent was told that the batch failed */
+    if (batch_ctx->failed)
+        return;
+
+    scmi_reset_batch_notify(agent_id);
+}
+
 static void scmi_reset_issued_notify(uint32_t domain_id,
                                      uint32_t reset_state,
                                      uintptr_t cookie)
@@ -521,6 +708,32 @@ static unsigned int get_reset_domain_id(const uint32_t *payload)
     return params->domain_id;
 }
 
+static int scmi_reset_domain_batch_permissions_handler(
+    fwk_id_t service_id,
+    const struct scmi_reset_domain_request_batch_a2p *params)
+{
+    enum mod_res_perms_permissions perms;
+    unsigned int agent_id;
+    uint32_t domain_idx;
+    int status;
+
+    status = scmi_rd_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS)
+        return FWK_E_ACCESS;
+
+    for (domain_idx = 0; domain_idx < params->domain_count; domain_idx++) {
+        perms = scmi_rd_ctx.res_perms_api->agent_has_resource_permission(
+            agent_id,
+            MOD_SCMI_PROTOCOL_ID_RESET_DOMAIN,
+            MOD_SCMI_RESET_REQUEST,
+            params->domain_ids[domain_idx]);
+        if (perms != MOD_RES_PERMS_ACCESS_ALLOWED)
+            return FWK_E_ACCESS;
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int scmi_reset_domain_permissions_handler(
     fwk_id_t service_id,
     const uint32_t *payload,
@@ -558,6 +771,47 @@ static int scmi_reset_get_scmi_protocol_id(fwk_id_t protocol_id,
     return FWK_SUCCESS;
 }
 
+/*
+ * The batched reset request has a variable length payload and an identifier
+ * beyond the standard commands, so it is validated here rather than through
+ * the handler and payload size tables.
+ */
+static int scmi_reset_batch_message_handler(fwk_id_t service_id,
+                                            const uint32_t *payload,
+                                            size_t payload_size)
+{
+    const struct scmi_reset_domain_request_batch_a2p *params;
+    int32_t return_value = (int32_t)SCMI_SUCCESS;
+
+    params = (const struct scmi_reset_domain_request_batch_a2p *)payload;
+
+    if (scmi_rd_ctx.batch_ctx_table == NULL) {
+        return_value = (int32_t)SCMI_NOT_FOUND;
+    } else if (
+        (payload_size < sizeof(*params)) || (params->domain_count == 0) ||
+        (params->domain_count > scmi_rd_ctx.config->batch_domain_count_max) ||
+        (payload_size !=
+         (sizeof(*params) +
+          (params->domain_count * sizeof(params->domain_ids[0]))))) {
+        return_value = (int32_t)SCMI_PROTOCOL_ERROR;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    if ((return_value == SCMI_SUCCESS) &&
+        (scmi_reset_domain_batch_permissions_handler(service_id, params) !=
+         FWK_SUCCESS)) {
+        return_value = (int32_t)SCMI_DENIED;
+    }
+#endif
+
+    if (return_value != SCMI_SUCCESS) {
+        return scmi_rd_ctx.scmi_api->respond(
+            service_id, &return_value, sizeof(return_value));
+    }
+
+    return reset_request_batch_handler(service_id, params);
+}
+
 static int scmi_reset_message_handler(fwk_id_t protocol_id,
                                       fwk_id_t service_id,
                                       const uint32_t *payload,
@@ -570,6 +824,11 @@ static int scmi_reset_message_handler(fwk_id_t protocol_id,
                   FWK_ARRAY_SIZE(payload_size_table),
                   "[SCMI] reset domain protocol table sizes not consistent");
 
+    if (message_id == SCMI_RESET_DOMAIN_REQUEST_BATCH) {
+        return scmi_reset_batch_message_handler(
+            service_id, payload, payload_size);
+    }
+
     validation_result = scmi_rd_ctx.scmi_api->scmi_message_validation(
         MOD_SCMI_PROTOCOL_ID_RESET_DOMAIN,
         service_id,
@@ -619,6 +878,11 @@ static int scmi_reset_init(fwk_id_t module_id,
 
     scmi_rd_ctx.config = config;
 
+    if (config->batch_domain_count_max != 0) {
+        scmi_rd_ctx.batch_ctx_table = fwk_mm_calloc(
+            config->agent_count, sizeof(scmi_rd_ctx.batch_ctx_table[0]));
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -704,13 +968,19 @@ static int scmi_reset_process_notification(const struct fwk_event *event,
 {
     struct mod_reset_domain_notification_event_params* params =
         (struct mod_reset_domain_notification_event_params*)event->params;
+    uintptr_t agent_id;
 
     if (!fwk_id_is_equal(scmi_rd_ctx.notification_id,
                          event->id))
         return FWK_E_SUPPORT;
 
+    agent_id = params->cookie & ~SCMI_RESET_DOMAIN_BATCH_COOKIE;
+
     scmi_reset_issued_notify(params->domain_id, params->reset_state,
-                             params->cookie);
+                             agent_id);
+
+    if ((params->cookie & SCMI_RESET_DOMAIN_BATCH_COOKIE) != 0)
+        scmi_reset_batch_complete((unsigned int)agent_id);
 
     return FWK_SUCCESS;
 }
@@ -0,0 +1,72 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI reset domain unit test configuration.
+ */
+
+#include <mod_reset_domain.h>
+#include <mod_scmi_reset_domain.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+
+enum fake_scmi_agent_idx {
+    FAKE_SCMI_AGENT_IDX_PSCI,
+    FAKE_SCMI_AGENT_IDX_OSPM,
+    FAKE_SCMI_AGENT_IDX_COUNT,
+};
+
+enum fake_reset_domain_idx {
+    FAKE_RESET_DOMAIN_IDX_0,
+    FAKE_RESET_DOMAIN_IDX_1,
+    FAKE_RESET_DOMAIN_IDX_2,
+    FAKE_RESET_DOMAIN_IDX_COUNT,
+};
+
+#define FAKE_BATCH_DOMAIN_COUNT_MAX FAKE_RESET_DOMAIN_IDX_COUNT
+
+static const struct mod_scmi_reset_domain_device fake_reset_device_table[] = {
+    [FAKE_RESET_DOMAIN_IDX_0] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_RESET_DOMAIN, FAKE_RESET_DOMAIN_IDX_0),
+        .permissions = MOD_SCMI_RESET_DOMAIN_PERM_ATTRIBUTES |
+            MOD_SCMI_RESET_DOMAIN_PERM_RESET,
+    },
+    [FAKE_RESET_DOMAIN_IDX_1] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_RESET_DOMAIN, FAKE_RESET_DOMAIN_IDX_1),
+        .permissions = MOD_SCMI_RESET_DOMAIN_PERM_ATTRIBUTES |
+            MOD_SCMI_RESET_DOMAIN_PERM_RESET,
+    },
+    [FAKE_RESET_DOMAIN_IDX_2] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_RESET_DOMAIN, FAKE_RESET_DOMAIN_IDX_2),
+        .permissions = MOD_SCMI_RESET_DOMAIN_PERM_ATTRIBUTES |
+            MOD_SCMI_RESET_DOMAIN_PERM_RESET,
+    },
+};
+
+static const struct mod_scmi_reset_domain_agent fake_agent_table[] = {
+    [FAKE_SCMI_AGENT_IDX_PSCI] = { 0 /* No access */ },
+    [FAKE_SCMI_AGENT_IDX_OSPM] = {
+        .device_table = fake_reset_device_table,
+        .agent_domain_count = FWK_ARRAY_SIZE(fake_reset_device_table),
+    },
+};
+
+static const struct mod_scmi_reset_domain_config fake_config = {
+    .agent_table = fake_agent_table,
+    .agent_count = FWK_ARRAY_SIZE(fake_agent_table),
+    .batch_domain_count_max = FAKE_BATCH_DOMAIN_COUNT_MAX,
+};
+
+static const struct mod_reset_domain_dev_config fake_reset_dev_config = {
+    .modes = MOD_RESET_DOMAIN_AUTO_RESET |
+        MOD_RESET_DOMAIN_MODE_AUTO_RESET_ASYNC,
+    .capabilities = MOD_RESET_DOMAIN_CAP_NOTIFICATION,
+};
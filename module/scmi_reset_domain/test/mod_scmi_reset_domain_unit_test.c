@@ -0,0 +1,429 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include UNIT_TEST_SRC
+
+#include <config_scmi_reset_domain.h>
+
+#define FAKE_SERVICE_IDX 0
+
+/* Policy status returned by the test reset request policy */
+extern enum mod_scmi_reset_domain_policy_status fake_policy_status;
+
+static const fwk_id_t fake_service_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, FAKE_SERVICE_IDX);
+
+static struct scmi_rd_batch_ctx batch_ctx_table[FAKE_SCMI_AGENT_IDX_COUNT];
+static struct scmi_rd_batch_ctx *const ospm_batch_ctx =
+    &batch_ctx_table[FAKE_SCMI_AGENT_IDX_OSPM];
+
+static unsigned int fake_agent_id;
+
+/* Number of reset domain requests after which set_reset_state fails */
+static unsigned int set_reset_state_fail_after;
+static unsigned int set_reset_state_count;
+static uintptr_t set_reset_state_cookie;
+
+static unsigned int respond_count;
+static struct scmi_reset_domain_request_batch_p2a batch_response;
+
+static unsigned int notify_count;
+static unsigned int notify_respond_count;
+static int notify_message_id;
+static struct scmi_reset_domain_batch_complete_p2a batch_complete;
+
+static unsigned int denied_domain_id;
+
+static struct {
+    struct scmi_reset_domain_request_batch_a2p params;
+    uint32_t domain_ids[FAKE_RESET_DOMAIN_IDX_COUNT];
+} batch_request;
+
+static int fake_get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    *agent_id = fake_agent_id;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_agent_id_fail(fwk_id_t service_id, unsigned int *agent_id)
+{
+    return FWK_E_PARAM;
+}
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    respond_count++;
+
+    TEST_ASSERT_EQUAL(sizeof(batch_response), size);
+    memcpy(&batch_response, payload, sizeof(batch_response));
+
+    return FWK_SUCCESS;
+}
+
+static void fake_notify(
+    fwk_id_t service_id,
+    int protocol_id,
+    int message_id,
+    const void *payload,
+    size_t size)
+{
+    notify_count++;
+    notify_respond_count = respond_count;
+    notify_message_id = message_id;
+
+    TEST_ASSERT_EQUAL(MOD_SCMI_PROTOCOL_ID_RESET_DOMAIN, protocol_id);
+    TEST_ASSERT_EQUAL(sizeof(batch_complete), size);
+    memcpy(&batch_complete, payload, sizeof(batch_complete));
+}
+
+static int fake_set_reset_state(
+    fwk_id_t element_id,
+    enum mod_reset_domain_mode mode,
+    uint32_t reset_state,
+    uintptr_t cookie)
+{
+    set_reset_state_cookie = cookie;
+
+    if (set_reset_state_count++ >= set_reset_state_fail_after)
+        return FWK_E_STATE;
+
+    return FWK_SUCCESS;
+}
+
+static enum mod_res_perms_permissions fake_agent_has_resource_permission(
+    uint32_t agent_id,
+    uint32_t protocol_id,
+    uint32_t message_id,
+    uint32_t resource_id)
+{
+    if (resource_id == denied_domain_id)
+        return MOD_RES_PERMS_ACCESS_DENIED;
+
+    return MOD_RES_PERMS_ACCESS_ALLOWED;
+}
+
+static struct mod_scmi_from_protocol_api scmi_api = {
+    .get_agent_id = fake_get_agent_id,
+    .respond = fake_respond,
+    .notify = fake_notify,
+};
+
+static struct mod_reset_domain_api reset_api = {
+    .set_reset_state = fake_set_reset_state,
+};
+
+static struct mod_res_permissions_api res_perms_api = {
+    .agent_has_resource_permission = fake_agent_has_resource_permission,
+};
+
+static void set_batch_request(uint32_t flags, uint32_t domain_count)
+{
+    uint32_t domain_idx;
+
+    batch_request.params.flags = flags;
+    batch_request.params.reset_state = 0;
+    batch_request.params.domain_count = domain_count;
+
+    for (domain_idx = 0; domain_idx < domain_count; domain_idx++)
+        batch_request.domain_ids[domain_idx] = domain_idx;
+}
+
+void setUp(void)
+{
+    memset(batch_ctx_table, 0, sizeof(batch_ctx_table));
+
+    scmi_rd_ctx.config = &fake_config;
+    scmi_rd_ctx.scmi_api = &scmi_api;
+    scmi_rd_ctx.reset_api = &reset_api;
+    scmi_rd_ctx.res_perms_api = &res_perms_api;
+    scmi_rd_ctx.plat_reset_domain_count = FAKE_RESET_DOMAIN_IDX_COUNT;
+    scmi_rd_ctx.batch_ctx_table = batch_ctx_table;
+
+    scmi_api.get_agent_id = fake_get_agent_id;
+    fake_agent_id = FAKE_SCMI_AGENT_IDX_OSPM;
+    fake_policy_status = MOD_SCMI_RESET_DOMAIN_EXECUTE_MESSAGE_HANDLER;
+
+    set_reset_state_fail_after = UINT32_MAX;
+    set_reset_state_count = 0;
+    set_reset_state_cookie = 0;
+
+    respond_count = 0;
+    memset(&batch_response, 0, sizeof(batch_response));
+
+    notify_count = 0;
+    notify_respond_count = 0;
+    notify_message_id = 0;
+    memset(&batch_complete, 0, sizeof(batch_complete));
+
+    denied_domain_id = UINT32_MAX;
+
+    fwk_module_get_data_IgnoreAndReturn((void *)&fake_reset_dev_config);
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+}
+
+void tearDown(void)
+{
+}
+
+void utest_reset_request_batch_handler_sync(void)
+{
+    int status;
+
+    set_batch_request(SCMI_RESET_DOMAIN_AUTO, FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, batch_response.status);
+    TEST_ASSERT_EQUAL(
+        FAKE_RESET_DOMAIN_IDX_COUNT, batch_response.domain_count);
+    TEST_ASSERT_EQUAL(FAKE_RESET_DOMAIN_IDX_COUNT, set_reset_state_count);
+    TEST_ASSERT_EQUAL(FAKE_SCMI_AGENT_IDX_OSPM, set_reset_state_cookie);
+    TEST_ASSERT_EQUAL(0, ospm_batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_reset_request_batch_handler_async_pending(void)
+{
+    int status;
+
+    set_batch_request(
+        SCMI_RESET_DOMAIN_AUTO | SCMI_RESET_DOMAIN_ASYNC,
+        FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, batch_response.status);
+    TEST_ASSERT_EQUAL(
+        FAKE_RESET_DOMAIN_IDX_COUNT, batch_response.domain_count);
+    TEST_ASSERT_EQUAL(
+        FAKE_SCMI_AGENT_IDX_OSPM | SCMI_RESET_DOMAIN_BATCH_COOKIE,
+        set_reset_state_cookie);
+    TEST_ASSERT_EQUAL(
+        FAKE_RESET_DOMAIN_IDX_COUNT, ospm_batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_reset_request_batch_handler_async_none_pending(void)
+{
+    int status;
+
+    fake_policy_status = MOD_SCMI_RESET_DOMAIN_SKIP_MESSAGE_HANDLER;
+    set_batch_request(
+        SCMI_RESET_DOMAIN_AUTO | SCMI_RESET_DOMAIN_ASYNC,
+        FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, batch_response.status);
+    TEST_ASSERT_EQUAL(0, set_reset_state_count);
+    TEST_ASSERT_EQUAL(0, ospm_batch_ctx->pending_count);
+
+    /* The batch completes right after the response */
+    TEST_ASSERT_EQUAL(1, notify_count);
+    TEST_ASSERT_EQUAL(1, notify_respond_count);
+    TEST_ASSERT_EQUAL(SCMI_RESET_DOMAIN_BATCH_COMPLETE, notify_message_id);
+    TEST_ASSERT_EQUAL(FAKE_SCMI_AGENT_IDX_OSPM, batch_complete.agent_id);
+    TEST_ASSERT_EQUAL(
+        FAKE_RESET_DOMAIN_IDX_COUNT, batch_complete.domain_count);
+}
+
+void utest_reset_request_batch_handler_async_failure(void)
+{
+    int status;
+
+    set_reset_state_fail_after = 1;
+    set_batch_request(
+        SCMI_RESET_DOMAIN_AUTO | SCMI_RESET_DOMAIN_ASYNC,
+        FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+    TEST_ASSERT_EQUAL(SCMI_HARDWARE_ERROR, batch_response.status);
+    TEST_ASSERT_EQUAL(1, batch_response.domain_count);
+    TEST_ASSERT_EQUAL(1, ospm_batch_ctx->pending_count);
+    TEST_ASSERT_TRUE(ospm_batch_ctx->failed);
+
+    /* The reset issued before the failure completes silently */
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_OSPM);
+
+    TEST_ASSERT_EQUAL(0, ospm_batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_reset_request_batch_handler_busy(void)
+{
+    int status;
+
+    ospm_batch_ctx->pending_count = 1;
+    set_batch_request(
+        SCMI_RESET_DOMAIN_AUTO | SCMI_RESET_DOMAIN_ASYNC,
+        FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(SCMI_BUSY, batch_response.status);
+    TEST_ASSERT_EQUAL(0, batch_response.domain_count);
+    TEST_ASSERT_EQUAL(0, set_reset_state_count);
+    TEST_ASSERT_EQUAL(1, ospm_batch_ctx->pending_count);
+}
+
+void utest_reset_request_batch_handler_invalid_domain(void)
+{
+    int status;
+
+    set_batch_request(SCMI_RESET_DOMAIN_AUTO, FAKE_RESET_DOMAIN_IDX_COUNT);
+    batch_request.domain_ids[1] = FAKE_RESET_DOMAIN_IDX_COUNT;
+
+    status = reset_request_batch_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, batch_response.status);
+    TEST_ASSERT_EQUAL(1, batch_response.domain_count);
+    TEST_ASSERT_EQUAL(1, set_reset_state_count);
+}
+
+void utest_scmi_reset_batch_complete(void)
+{
+    struct scmi_rd_batch_ctx *batch_ctx = ospm_batch_ctx;
+
+    batch_ctx->service_id = fake_service_id;
+    batch_ctx->domain_count = FAKE_RESET_DOMAIN_IDX_COUNT;
+    batch_ctx->pending_count = 2;
+
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_OSPM);
+
+    TEST_ASSERT_EQUAL(1, batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(0, notify_count);
+
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_OSPM);
+
+    TEST_ASSERT_EQUAL(0, batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(1, notify_count);
+    TEST_ASSERT_EQUAL(SCMI_RESET_DOMAIN_BATCH_COMPLETE, notify_message_id);
+    TEST_ASSERT_EQUAL(FAKE_SCMI_AGENT_IDX_OSPM, batch_complete.agent_id);
+    TEST_ASSERT_EQUAL(
+        FAKE_RESET_DOMAIN_IDX_COUNT, batch_complete.domain_count);
+}
+
+void utest_scmi_reset_batch_complete_not_pending(void)
+{
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_OSPM);
+
+    TEST_ASSERT_EQUAL(0, ospm_batch_ctx->pending_count);
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_scmi_reset_batch_complete_invalid_agent(void)
+{
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_COUNT);
+
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_scmi_reset_batch_complete_no_batch(void)
+{
+    scmi_rd_ctx.batch_ctx_table = NULL;
+
+    scmi_reset_batch_complete(FAKE_SCMI_AGENT_IDX_OSPM);
+
+    TEST_ASSERT_EQUAL(0, notify_count);
+}
+
+void utest_scmi_reset_domain_batch_permissions_handler(void)
+{
+    int status;
+
+    set_batch_request(SCMI_RESET_DOMAIN_AUTO, FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = scmi_reset_domain_batch_permissions_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void utest_scmi_reset_domain_batch_permissions_handler_denied(void)
+{
+    int status;
+
+    denied_domain_id = FAKE_RESET_DOMAIN_IDX_2;
+    set_batch_request(SCMI_RESET_DOMAIN_AUTO, FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = scmi_reset_domain_batch_permissions_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_E_ACCESS, status);
+}
+
+void utest_scmi_reset_domain_batch_permissions_handler_no_agent(void)
+{
+    int status;
+
+    scmi_api.get_agent_id = fake_get_agent_id_fail;
+    set_batch_request(SCMI_RESET_DOMAIN_AUTO, FAKE_RESET_DOMAIN_IDX_COUNT);
+
+    status = scmi_reset_domain_batch_permissions_handler(
+        fake_service_id, &batch_request.params);
+
+    TEST_ASSERT_EQUAL(FWK_E_ACCESS, status);
+}
+
+int scmi_reset_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(utest_reset_request_batch_handler_sync);
+    RUN_TEST(utest_reset_request_batch_handler_async_pending);
+    RUN_TEST(utest_reset_request_batch_handler_async_none_pending);
+    RUN_TEST(utest_reset_request_batch_handler_async_failure);
+    RUN_TEST(utest_reset_request_batch_handler_busy);
+    RUN_TEST(utest_reset_request_batch_handler_invalid_domain);
+    RUN_TEST(utest_scmi_reset_batch_complete);
+    RUN_TEST(utest_scmi_reset_batch_complete_not_pending);
+    RUN_TEST(utest_scmi_reset_batch_complete_invalid_agent);
+    RUN_TEST(utest_scmi_reset_batch_complete_no_batch);
+    RUN_TEST(utest_scmi_reset_domain_batch_permissions_handler);
+    RUN_TEST(utest_scmi_reset_domain_batch_permissions_handler_denied);
+    RUN_TEST(utest_scmi_reset_domain_batch_permissions_handler_no_agent);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_reset_domain_test_main();
+}
+#endif
@@ -0,0 +1,30 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      Reset request policy of the SCMI reset domain unit tests, overriding
+ *      the weak definition of the module so that the tests can skip the
+ *      reset requests.
+ */
+
+#include <mod_scmi_reset_domain.h>
+
+#include <fwk_status.h>
+
+enum mod_scmi_reset_domain_policy_status fake_policy_status =
+    MOD_SCMI_RESET_DOMAIN_EXECUTE_MESSAGE_HANDLER;
+
+int scmi_reset_domain_reset_request_policy(
+    enum mod_scmi_reset_domain_policy_status *policy_status,
+    enum mod_reset_domain_mode *mode,
+    uint32_t *reset_state,
+    uint32_t agent_id,
+    uint32_t domain_id)
+{
+    *policy_status = fake_policy_status;
+
+    return FWK_SUCCESS;
+}
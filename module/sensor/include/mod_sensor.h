@@ -12,6 +12,7 @@
 #include <fwk_module_idx.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -446,6 +447,27 @@ struct mod_sensor_driver_api {
      */
     int (*get_value)(fwk_id_t id, mod_sensor_value_t *value);
 
+    /*!
+     * \brief Get the values of all the channels of a device in one scan.
+     *
+     * \details This function is optional. When it is provided, the sensors
+     *      whose driver identifier is a sub-element of the same driver element
+     *      are read together, in a single scan of that device. The index of
+     *      the sub-element is the index of the channel.
+     *
+     * \param id Driver element identifier of the device.
+     * \param[out] values Channel values, indexed by channel. When the request
+     *      is pending, the buffer remains valid until the driver reports the
+     *      completion of the scan.
+     * \param count Number of channels in \p values.
+     *
+     * \retval ::FWK_PENDING The request is pending. The driver will fill the
+     *      values later and report it through the driver response API.
+     * \retval ::FWK_SUCCESS The values were read successfully.
+     * \return One of the standard framework error codes.
+     */
+    int (*get_values)(fwk_id_t id, mod_sensor_value_t *values, size_t count);
+
     /*!
      * \brief Get sensor information.
      *
@@ -752,6 +774,19 @@ struct mod_sensor_driver_response_api {
      */
     void (*reading_complete)(fwk_id_t id,
                              struct mod_sensor_driver_resp_params *response);
+
+    /*!
+     * \brief Inform the completion of a scan requested through the
+     *      \c get_values function of the driver API.
+     *
+     * \details The values are read from the buffer given to the driver when
+     *      the scan was requested, and are reported to every sensor of the
+     *      device.
+     *
+     * \param id Identifier of any sensor of the device.
+     * \param status Status of the scan.
+     */
+    void (*batch_reading_complete)(fwk_id_t id, int status);
 };
 
 /*!
@@ -132,6 +132,103 @@ static void trip_point_process(fwk_id_t id, struct mod_sensor_data *data)
 }
 #endif
 
+/*
+ * Report the result of a scan to every sensor of the device. When the scan
+ * was pending, the sensors waiting for it are sent their reading completion.
+ */
+static void batch_update(struct sensor_batch_ctx *batch, int status)
+{
+    int event_status;
+    unsigned int i;
+    fwk_id_t id;
+    struct fwk_event event;
+    struct sensor_dev_ctx *ctx;
+    bool scan_was_pending = batch->pending;
+
+    batch->pending = false;
+
+    for (i = 0; i < sensor_mod_ctx.element_count; i++) {
+        ctx = &ctx_table[i];
+        if ((ctx->batch != batch) || (ctx->axis_count > 1)) {
+            continue;
+        }
+
+        id = fwk_id_build_element_id(fwk_module_id_sensor, i);
+
+        ctx->last_read.status = status;
+        if (status == FWK_SUCCESS) {
+            ctx->last_read.value = batch->values[ctx->channel];
+#ifdef BUILD_HAS_SENSOR_TIMESTAMP
+            ctx->last_read.timestamp = sensor_get_timestamp(id);
+#endif
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+            trip_point_process(id, &ctx->last_read);
+#endif
+        }
+
+        if (!scan_was_pending ||
+            (ctx->concurrency_readings.pending_requests == 0)) {
+            continue;
+        }
+
+        event = (struct fwk_event){
+            .id = mod_sensor_event_id_read_complete,
+            .source_id = ctx->config->driver_id,
+            .target_id = id,
+        };
+
+        ctx->concurrency_readings.dequeuing = true;
+
+        event_status = fwk_put_event(&event);
+        fwk_assert(event_status == FWK_SUCCESS);
+    }
+}
+
+static int batch_read(struct sensor_dev_ctx *ctx)
+{
+    int status;
+    struct sensor_batch_ctx *batch = ctx->batch;
+
+    if (batch->pending) {
+        /* The scan in progress also reads this sensor */
+        return FWK_PENDING;
+    }
+
+    status = ctx->driver_api->get_values(
+        batch->device_id, batch->values, batch->channel_count);
+    if (status == FWK_PENDING) {
+        batch->pending = true;
+    } else {
+        batch_update(batch, status);
+    }
+
+    return status;
+}
+
+static int read_value(fwk_id_t id, struct sensor_dev_ctx *ctx)
+{
+    int status;
+
+    /* The scans of a device only return scalar values */
+    if ((ctx->batch != NULL) && (ctx->axis_count == 1)) {
+        return batch_read(ctx);
+    }
+
+    status = ctx->driver_api->get_value(
+        ctx->config->driver_id, &ctx->last_read.value);
+    ctx->last_read.status = status;
+    if (status == FWK_SUCCESS) {
+#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
+        trip_point_process(id, &ctx->last_read);
+#endif
+#ifdef BUILD_HAS_SENSOR_TIMESTAMP
+        ctx->last_read.timestamp = sensor_get_timestamp(id);
+#endif
+    }
+
+    return status;
+}
+
 static int is_sensor_enabled(fwk_id_t id, bool *sensor_is_enabled)
 {
     int status;
@@ -192,16 +289,8 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
     }
 
     if (ctx->concurrency_readings.pending_requests == 0) {
-        status = ctx->driver_api->get_value(
-            ctx->config->driver_id, &ctx->last_read.value);
-        ctx->last_read.status = status;
+        status = read_value(id, ctx);
         if (status == FWK_SUCCESS) {
-#ifdef BUILD_HAS_SCMI_SENSOR_EVENTS
-            trip_point_process(id, &ctx->last_read);
-#endif
-#ifdef BUILD_HAS_SENSOR_TIMESTAMP
-            ctx->last_read.timestamp = sensor_get_timestamp(id);
-#endif
             sensor_data_copy(data, &ctx->last_read);
 
             return status;
@@ -224,12 +313,19 @@ static int get_data(fwk_id_t id, struct mod_sensor_data *data)
     /* Save data address to copy return values in there */
     event_params->sensor_data = data;
 
+    /*
+     * The request is accounted for before it is queued, so that a scan
+     * completing in the meantime sends it its reading completion.
+     */
+    ctx->concurrency_readings.pending_requests++;
+
     status = fwk_put_event(&req);
     if (status != FWK_SUCCESS) {
+        ctx->concurrency_readings.pending_requests--;
+
         return status;
     }
 
-    ctx->concurrency_readings.pending_requests++;
     /*
      * We return FWK_PENDING here to indicate to the caller that the
      * result of the request is pending and will arrive later through
@@ -463,8 +559,25 @@ static void reading_complete(fwk_id_t dev_id,
     fwk_assert(status == FWK_SUCCESS);
 }
 
+static void batch_reading_complete(fwk_id_t id, int status)
+{
+    struct sensor_batch_ctx *batch;
+
+    if (!fwk_expect(fwk_id_get_module_idx(id) == FWK_MODULE_IDX_SENSOR)) {
+        return;
+    }
+
+    batch = ctx_table[fwk_id_get_element_idx(id)].batch;
+    if (!fwk_expect((batch != NULL) && batch->pending)) {
+        return;
+    }
+
+    batch_update(batch, status);
+}
+
 static struct mod_sensor_driver_response_api sensor_driver_response_api = {
     .reading_complete = reading_complete,
+    .batch_reading_complete = batch_reading_complete,
 };
 
 /*
@@ -482,6 +595,7 @@ static int sensor_init(
     config = (struct mod_sensor_config *)data;
 
     sensor_mod_ctx.config = config;
+    sensor_mod_ctx.element_count = element_count;
     return FWK_SUCCESS;
 }
 
@@ -520,6 +634,66 @@ static int sensor_dev_init(fwk_id_t element_id,
 #endif
 }
 
+/*
+ * Group the sensor with the sensors bound before it that are read through the
+ * same driver device.
+ */
+static int batch_bind(struct sensor_dev_ctx *ctx, unsigned int element_idx)
+{
+    unsigned int i;
+    fwk_id_t driver_id = ctx->config->driver_id;
+    fwk_id_t device_id;
+    struct sensor_batch_ctx *batch = NULL;
+
+    if (!fwk_id_is_type(driver_id, FWK_ID_TYPE_SUB_ELEMENT)) {
+        return FWK_SUCCESS;
+    }
+
+    device_id =
+        fwk_id_build_element_id(driver_id, fwk_id_get_element_idx(driver_id));
+
+    for (i = 0; i < element_idx; i++) {
+        if ((ctx_table[i].batch != NULL) &&
+            fwk_id_is_equal(ctx_table[i].batch->device_id, device_id)) {
+            batch = ctx_table[i].batch;
+            break;
+        }
+    }
+
+    if (batch == NULL) {
+        batch = fwk_mm_calloc(1, sizeof(*batch));
+        batch->device_id = device_id;
+    }
+
+    ctx->batch = batch;
+    ctx->channel = fwk_id_get_sub_element_idx(driver_id);
+    if (ctx->channel >= batch->channel_count) {
+        batch->channel_count = ctx->channel + 1;
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Allocate the channel values of every device once all the sensors have been
+ * grouped.
+ */
+static int batch_start(void)
+{
+    unsigned int i;
+    struct sensor_batch_ctx *batch;
+
+    for (i = 0; i < sensor_mod_ctx.element_count; i++) {
+        batch = ctx_table[i].batch;
+        if ((batch != NULL) && (batch->values == NULL)) {
+            batch->values =
+                fwk_mm_calloc(batch->channel_count, sizeof(batch->values[0]));
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int sensor_bind(fwk_id_t id, unsigned int round)
 {
     struct sensor_dev_ctx *ctx;
@@ -567,25 +741,32 @@ static int sensor_bind(fwk_id_t id, unsigned int round)
 
     ctx->driver_api = driver;
 
+    if (driver->get_values != NULL) {
+        return batch_bind(ctx, fwk_id_get_element_idx(id));
+    }
+
     return FWK_SUCCESS;
 }
 
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
 int sensor_start(fwk_id_t id)
 {
+#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     int status;
+#endif
 
     if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
-        return FWK_SUCCESS;
+        return batch_start();
     }
+
+#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     status = sensor_axis_start(id);
     if (status != FWK_SUCCESS) {
         return status;
     }
+#endif
 
     return FWK_SUCCESS;
 }
-#endif
 
 static int sensor_process_bind_request(fwk_id_t source_id,
                                        fwk_id_t target_id,
@@ -737,9 +918,7 @@ const struct fwk_module module_sensor = {
     .init = sensor_init,
     .element_init = sensor_dev_init,
     .bind = sensor_bind,
-#ifdef BUILD_HAS_SENSOR_MULTI_AXIS
     .start = sensor_start,
-#endif
     .process_bind_request = sensor_process_bind_request,
     .process_event = sensor_process_event,
 };
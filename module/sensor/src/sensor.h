@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,7 @@
 
 #include <fwk_id.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /*!
@@ -37,6 +38,24 @@ struct sensor_trip_point_ctx {
     bool enabled;
 };
 
+/*
+ * Context of the batched readings of a driver device, shared by all the
+ * sensors of the device.
+ */
+struct sensor_batch_ctx {
+    /* Driver element identifier of the device */
+    fwk_id_t device_id;
+
+    /* Number of channels read in a scan */
+    unsigned int channel_count;
+
+    /* Channel values of the last scan */
+    mod_sensor_value_t *values;
+
+    /* A scan is in progress */
+    bool pending;
+};
+
 /*
  * Sensor element context
  */
@@ -57,6 +76,12 @@ struct sensor_dev_ctx {
 
     unsigned int axis_count;
 
+    /* Batched readings of the driver device, NULL if not supported */
+    struct sensor_batch_ctx *batch;
+
+    /* Channel of the sensor in the scans of the driver device */
+    unsigned int channel;
+
 #ifdef BUILD_HAS_SENSOR_TIMESTAMP
     struct mod_sensor_timestamp_info timestamp;
 #endif
@@ -70,6 +95,7 @@ struct sensor_dev_ctx {
 
 struct mod_sensor_ctx {
     struct mod_sensor_config *config;
+    unsigned int element_count;
     struct mod_sensor_trip_point_api *sensor_trip_point_api;
 };
 
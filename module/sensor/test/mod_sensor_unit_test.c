@@ -127,6 +127,28 @@ static int sensor_driver_disable_not_supported(fwk_id_t id)
     return FWK_E_SUPPORT;
 }
 
+static int sensor_driver_get_values(
+    fwk_id_t id,
+    mod_sensor_value_t *values,
+    size_t count)
+{
+    size_t channel;
+
+    for (channel = 0; channel < count; channel++) {
+        values[channel] = FAKE_RETURN_VALUE + channel;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int sensor_driver_get_values_pending(
+    fwk_id_t id,
+    mod_sensor_value_t *values,
+    size_t count)
+{
+    return FWK_PENDING;
+}
+
 static struct mod_sensor_driver_api sensor_driver_api = {
     .get_value = sensor_driver_get_value,
     .get_info = sensor_driver_get_info,
@@ -139,6 +161,36 @@ static struct mod_sensor_driver_api sensor_driver_api_error = {
     .set_update_interval = sensor_driver_set_update_returns_error,
 };
 
+static struct mod_sensor_driver_api sensor_driver_api_batch = {
+    .get_value = sensor_driver_get_value,
+    .get_values = sensor_driver_get_values,
+    .get_info = sensor_driver_get_info_enabled,
+};
+
+static mod_sensor_value_t batch_values[SENSOR_ELEMENT_COUNT];
+
+static struct sensor_batch_ctx batch_context;
+
+static void batch_setup(void)
+{
+    unsigned int i;
+
+    memset(&batch_context, 0, sizeof(batch_context));
+    memset(batch_values, 0, sizeof(batch_values));
+
+    batch_context.channel_count = SENSOR_ELEMENT_COUNT;
+    batch_context.values = batch_values;
+
+    sensor_mod_ctx.element_count = SENSOR_ELEMENT_COUNT;
+
+    for (i = 0; i < SENSOR_ELEMENT_COUNT; i++) {
+        ctx_table[i].driver_api = &sensor_driver_api_batch;
+        ctx_table[i].batch = &batch_context;
+        ctx_table[i].channel = i;
+        ctx_table[i].axis_count = 1;
+    }
+}
+
 void setUp(void)
 {
     ctx_table = sensor_dev_context;
@@ -782,6 +834,202 @@ void utest_sensor_get_data_valid_call_zero_pending_requests(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+void utest_sensor_get_data_batch_updates_all_channels(void)
+{
+    int status;
+    struct mod_sensor_data returned_data;
+
+    fwk_id_t elem_id_0 =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+    fwk_id_t elem_id_1 =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_1);
+
+    memset(&returned_data, 0, sizeof(returned_data));
+
+    batch_setup();
+    sensor_driver_api_batch.get_values = sensor_driver_get_values;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id_1, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id_1, SENSOR_FAKE_INDEX_1);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id_1, SENSOR_FAKE_INDEX_1);
+
+    fwk_id_build_element_id_ExpectAndReturn(
+        fwk_module_id_sensor, SENSOR_FAKE_INDEX_0, elem_id_0);
+    fwk_id_build_element_id_ExpectAndReturn(
+        fwk_module_id_sensor, SENSOR_FAKE_INDEX_1, elem_id_1);
+
+    fwk_str_memcpy_StubWithCallback(memcpy_callback);
+
+    status = get_data(elem_id_1, &returned_data);
+
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(returned_data.status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(returned_data.value, FAKE_RETURN_VALUE + 1);
+
+    /* The other sensor of the device is refreshed by the same scan */
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].last_read.status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].last_read.value, FAKE_RETURN_VALUE);
+    TEST_ASSERT_FALSE(batch_context.pending);
+}
+
+void utest_sensor_get_data_batch_pending(void)
+{
+    int status;
+    struct mod_sensor_data returned_data;
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    batch_setup();
+    sensor_driver_api_batch.get_values = sensor_driver_get_values_pending;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = get_data(elem_id, &returned_data);
+
+    TEST_ASSERT_EQUAL(status, FWK_PENDING);
+    TEST_ASSERT_TRUE(batch_context.pending);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests,
+        1);
+}
+
+static int put_event_callback_one_pending(
+    struct fwk_event *event,
+    int cmock_num_calls)
+{
+    /* The request is accounted for by the time it is queued */
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests,
+        1);
+
+    return FWK_SUCCESS;
+}
+
+void utest_sensor_get_data_batch_pending_accounted_before_queued(void)
+{
+    int status;
+    struct mod_sensor_data returned_data;
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    batch_setup();
+    sensor_driver_api_batch.get_values = sensor_driver_get_values_pending;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+
+    __fwk_put_event_StubWithCallback(put_event_callback_one_pending);
+
+    status = get_data(elem_id, &returned_data);
+
+    TEST_ASSERT_EQUAL(status, FWK_PENDING);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests,
+        1);
+}
+
+void utest_sensor_get_data_batch_put_event_fails(void)
+{
+    int status;
+    struct mod_sensor_data returned_data;
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+
+    batch_setup();
+    sensor_driver_api_batch.get_values = sensor_driver_get_values_pending;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_0);
+
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_E_NOMEM);
+
+    status = get_data(elem_id, &returned_data);
+
+    /* The request was not queued, it is no longer accounted for */
+    TEST_ASSERT_EQUAL(status, FWK_E_NOMEM);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests,
+        0);
+}
+
+void utest_sensor_get_data_batch_scan_in_progress(void)
+{
+    int status;
+    struct mod_sensor_data returned_data;
+
+    fwk_id_t elem_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_1);
+
+    batch_setup();
+    batch_context.pending = true;
+
+    /* The driver must not be asked for another scan */
+    sensor_driver_api_batch.get_values = NULL;
+
+    fwk_id_is_type_ExpectAndReturn(elem_id, FWK_ID_TYPE_ELEMENT, true);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_1);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id, SENSOR_FAKE_INDEX_1);
+
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = get_data(elem_id, &returned_data);
+
+    TEST_ASSERT_EQUAL(status, FWK_PENDING);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_1].concurrency_readings.pending_requests,
+        1);
+}
+
+void utest_sensor_batch_reading_complete(void)
+{
+    fwk_id_t elem_id_0 =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_0);
+    fwk_id_t elem_id_1 =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, SENSOR_FAKE_INDEX_1);
+
+    batch_setup();
+    batch_context.pending = true;
+    batch_values[SENSOR_FAKE_INDEX_0] = FAKE_RETURN_VALUE;
+    batch_values[SENSOR_FAKE_INDEX_1] = FAKE_RETURN_VALUE + 1;
+
+    ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.pending_requests = 1;
+    ctx_table[SENSOR_FAKE_INDEX_1].concurrency_readings.pending_requests = 0;
+
+    fwk_id_get_module_idx_ExpectAndReturn(elem_id_0, FWK_MODULE_IDX_SENSOR);
+    fwk_id_get_element_idx_ExpectAndReturn(elem_id_0, SENSOR_FAKE_INDEX_0);
+
+    fwk_id_build_element_id_ExpectAndReturn(
+        fwk_module_id_sensor, SENSOR_FAKE_INDEX_0, elem_id_0);
+    fwk_id_build_element_id_ExpectAndReturn(
+        fwk_module_id_sensor, SENSOR_FAKE_INDEX_1, elem_id_1);
+
+    /* Only the sensor waiting for the scan is sent a read completion */
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    sensor_driver_response_api.batch_reading_complete(elem_id_0, FWK_SUCCESS);
+
+    TEST_ASSERT_FALSE(batch_context.pending);
+    TEST_ASSERT_TRUE(
+        ctx_table[SENSOR_FAKE_INDEX_0].concurrency_readings.dequeuing);
+    TEST_ASSERT_FALSE(
+        ctx_table[SENSOR_FAKE_INDEX_1].concurrency_readings.dequeuing);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_0].last_read.value, FAKE_RETURN_VALUE);
+    TEST_ASSERT_EQUAL(
+        ctx_table[SENSOR_FAKE_INDEX_1].last_read.value, FAKE_RETURN_VALUE + 1);
+}
+
 void utest_sensor_get_info_get_ctx_if_valid_call_returns_error(void)
 {
     int status;
@@ -1201,6 +1449,12 @@ int sensor_test_main(void)
     RUN_TEST(utest_sensor_get_data_sensor_disabled);
     RUN_TEST(utest_sensor_get_data_valid_dequeue);
     RUN_TEST(utest_sensor_get_data_valid_call_zero_pending_requests);
+    RUN_TEST(utest_sensor_get_data_batch_updates_all_channels);
+    RUN_TEST(utest_sensor_get_data_batch_pending);
+    RUN_TEST(utest_sensor_get_data_batch_pending_accounted_before_queued);
+    RUN_TEST(utest_sensor_get_data_batch_put_event_fails);
+    RUN_TEST(utest_sensor_get_data_batch_scan_in_progress);
+    RUN_TEST(utest_sensor_batch_reading_complete);
 
     RUN_TEST(utest_sensor_get_info_get_ctx_if_valid_call_returns_error);
     RUN_TEST(utest_sensor_get_info_driver_api_get_info_returns_error);
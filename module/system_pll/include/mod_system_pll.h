@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 #define MOD_SYSTEM_PLL_H
 
 #include <fwk_element.h>
+#include <fwk_id.h>
 #include <fwk_macros.h>
 
 #include <stdbool.h>
@@ -32,12 +33,74 @@
 /*! The maximum precision that can be used when setting the PLL rate. */
 #define MOD_SYSTEM_PLL_MIN_INTERVAL (1UL * FWK_KHZ)
 
+/*!
+ * The maximum number of lock status reads when waiting synchronously for the
+ * PLL to lock.
+ */
+#define MOD_SYSTEM_PLL_LOCK_TIMEOUT UINT32_C(0x100000)
+
+/*!
+ * The default time, in milliseconds, allowed for the PLL to lock when the rate
+ * change completes asynchronously.
+ */
+#define MOD_SYSTEM_PLL_LOCK_TIMEOUT_MS 10
+
+/*!
+ * The period, in milliseconds, of the lock status poll when the rate change
+ * completes asynchronously.
+ */
+#define MOD_SYSTEM_PLL_LOCK_POLL_PERIOD_MS 1
+
+/*! The deepest spread spectrum modulation, in parts per million. */
+#define MOD_SYSTEM_PLL_SPREAD_MAX_DEPTH_PPM UINT32_C(100000)
+
 /*! Indexes of APIs that the module offers for binding. */
 enum mod_system_pll_api_types {
     MOD_SYSTEM_PLL_API_TYPE_DEFAULT,
+    /*! Spread spectrum API, see ::mod_system_pll_spread_api */
+    MOD_SYSTEM_PLL_API_TYPE_SPREAD,
     MOD_SYSTEM_PLL_API_COUNT,
 };
 
+/*!
+ * \brief Spread spectrum modulation modes.
+ */
+enum mod_system_pll_spread_mode {
+    /*! The PLL output is not modulated. */
+    MOD_SYSTEM_PLL_SPREAD_MODE_NONE,
+
+    /*!
+     * The PLL output swings evenly around the programmed rate, the average
+     * rate is the programmed rate.
+     */
+    MOD_SYSTEM_PLL_SPREAD_MODE_CENTER,
+
+    /*!
+     * The PLL output swings below the programmed rate, the average rate is
+     * lower than the programmed rate by half the modulation depth.
+     */
+    MOD_SYSTEM_PLL_SPREAD_MODE_DOWN,
+
+    /*! Number of modes. */
+    MOD_SYSTEM_PLL_SPREAD_MODE_COUNT,
+};
+
+/*!
+ * \brief Spread spectrum modulation of the PLL output.
+ */
+struct mod_system_pll_spread {
+    /*! Modulation mode. */
+    enum mod_system_pll_spread_mode mode;
+
+    /*!
+     * \brief Peak to peak modulation depth, in parts per million of the
+     *      programmed rate.
+     *
+     * \details At most ::MOD_SYSTEM_PLL_SPREAD_MAX_DEPTH_PPM.
+     */
+    uint32_t depth_ppm;
+};
+
 /*!
  * \brief PLL device configuration.
  */
@@ -82,6 +145,108 @@ struct mod_system_pll_dev_config {
      * event.
      */
     const bool defer_initialization;
+
+    /*!
+     * \brief Identifier of the clock device using this PLL as its driver.
+     *
+     * \details When provided, rate changes requested through the driver API
+     *      complete asynchronously: if the PLL has not locked right after
+     *      being programmed, \c set_rate returns ::FWK_PENDING and the result
+     *      is reported to this clock device through the clock driver response
+     *      API once the PLL has locked, or with ::FWK_E_TIMEOUT when it fails
+     *      to lock in time. The rate changes done at initialization and on
+     *      power state transitions remain synchronous.
+     *
+     *      Leave it unset for PLLs driven by another driver that expects the
+     *      rate change to be complete on return, e.g. a CSS clock.
+     */
+    const fwk_id_t clock_id;
+
+    /*!
+     * \brief Identifier of the timer alarm polling the lock status.
+     *
+     * \details Required when \ref clock_id is provided. The alarm polls the
+     *      lock status every ::MOD_SYSTEM_PLL_LOCK_POLL_PERIOD_MS and bounds
+     *      the wait to \ref lock_timeout_ms.
+     */
+    const fwk_id_t alarm_id;
+
+    /*!
+     * \brief Time allowed for the PLL to lock, in milliseconds, when the rate
+     *      change completes asynchronously.
+     *
+     * \details ::MOD_SYSTEM_PLL_LOCK_TIMEOUT_MS is used when zero.
+     */
+    const uint32_t lock_timeout_ms;
+
+    /*!
+     * \brief Whether the PLL has a lock interrupt.
+     *
+     * \details When set along with \ref clock_id, \ref lock_irq completes
+     *      the rate change as soon as the PLL locks, the timer alarm then only
+     *      bounds the wait. Left unset, the alarm alone completes it.
+     */
+    const bool has_lock_irq;
+
+    /*!
+     * \brief PLL lock interrupt.
+     *
+     * \details Only used when \ref has_lock_irq is set.
+     */
+    const unsigned int lock_irq;
+
+    /*!
+     * \brief Initial spread spectrum modulation of the PLL output.
+     *
+     * \details The modulation is applied by the platform, e.g. by the PLL
+     *      controller or by the reference clock generator. The driver
+     *      programs the PLL so that the average rate of the modulated output
+     *      is the requested rate, rates are always expressed as average
+     *      rates. The programmed rate is capped to \ref max_rate, the average
+     *      rate is then slightly lower than requested at the top of the range.
+     *
+     *      Zero-initialized, the PLL output is not modulated.
+     */
+    const struct mod_system_pll_spread spread;
+};
+
+/*!
+ * \brief Spread spectrum API.
+ *
+ * \details Lets the clock and DVFS drivers query the modulation of the PLL
+ *      output and update it when the platform reconfigures the modulation,
+ *      e.g. around a DVFS transition.
+ */
+struct mod_system_pll_spread_api {
+    /*!
+     * \brief Get the spread spectrum modulation of the PLL output.
+     *
+     * \param dev_id Identifier of the PLL.
+     * \param[out] spread The modulation.
+     *
+     * \retval ::FWK_SUCCESS The modulation was returned.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     */
+    int (*get_spread)(fwk_id_t dev_id, struct mod_system_pll_spread *spread);
+
+    /*!
+     * \brief Set the spread spectrum modulation of the PLL output.
+     *
+     * \details The PLL is reprogrammed so that its average rate stays the
+     *      same with the new modulation. The next rate changes account for
+     *      the new modulation.
+     *
+     * \param dev_id Identifier of the PLL.
+     * \param spread The modulation.
+     *
+     * \retval ::FWK_SUCCESS The modulation was set.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_RANGE The modulation depth is too deep.
+     * \retval ::FWK_E_BUSY A rate change is pending.
+     * \retval ::FWK_E_TIMEOUT The PLL did not lock in time.
+     */
+    int (*set_spread)(fwk_id_t dev_id,
+                      const struct mod_system_pll_spread *spread);
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,22 +8,51 @@
 #include <mod_clock.h>
 #include <mod_power_domain.h>
 #include <mod_system_pll.h>
+#ifdef BUILD_HAS_MOD_TIMER
+#    include <mod_timer.h>
+#endif
 
 #include <fwk_id.h>
+#include <fwk_interrupt.h>
+#include <fwk_log.h>
 #include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
+#include <fwk_module_idx.h>
 #include <fwk_status.h>
 
 #include <stddef.h>
 #include <stdint.h>
 
+/* Parts per million */
+#define SYSTEM_PLL_PPM UINT64_C(1000000)
+
 /* Device context */
 struct system_pll_dev_ctx {
     bool initialized;
     uint64_t current_rate;
     enum mod_clock_state current_state;
     const struct mod_system_pll_dev_config *config;
+
+    /* Spread spectrum modulation of the PLL output */
+    struct mod_system_pll_spread spread;
+
+#ifdef BUILD_HAS_MOD_TIMER
+    /* Asynchronous rate change waiting for the PLL to lock */
+    volatile bool lock_pending;
+
+    /* Rate being set by the pending rate change */
+    uint64_t pending_rate;
+
+    /* Lock status polls left before the pending rate change times out */
+    uint32_t lock_polls_left;
+
+    /* Clock driver response API */
+    const struct mod_clock_driver_response_api *response_api;
+
+    /* Timer alarm API */
+    const struct mod_timer_alarm_api *alarm_api;
+#endif
 };
 
 /* Module context */
@@ -79,26 +108,188 @@ static unsigned int freq_to_half_cycle_ps(unsigned int freq_hz)
     return 500000000UL / freq_khz;
 }
 
+static bool system_pll_spread_is_valid(
+    const struct mod_system_pll_spread *spread)
+{
+    return (spread->mode < MOD_SYSTEM_PLL_SPREAD_MODE_COUNT) &&
+        (spread->depth_ppm <= MOD_SYSTEM_PLL_SPREAD_MAX_DEPTH_PPM);
+}
+
 /*
- * Clock driver API functions
+ * Return the rate to program for the modulated PLL output to average the given
+ * rate.
  */
+static uint64_t system_pll_programmed_rate(struct system_pll_dev_ctx *ctx,
+                                           uint64_t rate)
+{
+    uint64_t divisor;
+    uint64_t programmed_rate;
 
-static int system_pll_set_rate(fwk_id_t dev_id, uint64_t rate,
-                               enum mod_clock_round_mode round_mode)
+    if (ctx->spread.mode != MOD_SYSTEM_PLL_SPREAD_MODE_DOWN)
+        return rate;
+
+    /*
+     * A down spread lowers the average rate by half the depth:
+     *     average = programmed * (1 - depth / 2)
+     * Round up so that the average rate is not below the given rate.
+     */
+    divisor = (2 * SYSTEM_PLL_PPM) - ctx->spread.depth_ppm;
+    programmed_rate = ((rate * 2 * SYSTEM_PLL_PPM) + divisor - 1) / divisor;
+    programmed_rate = FWK_ALIGN_NEXT(programmed_rate, ctx->config->min_step);
+
+    if (programmed_rate > ctx->config->max_rate)
+        return ctx->config->max_rate;
+
+    return programmed_rate;
+}
+
+static bool system_pll_is_locked(struct system_pll_dev_ctx *ctx)
+{
+    if (ctx->config->status_reg == NULL)
+        return true;
+
+    return (*ctx->config->status_reg & ctx->config->lock_flag_mask) != 0;
+}
+
+/* Wait synchronously for the PLL to lock, within a bounded number of reads */
+static int system_pll_wait_lock(struct system_pll_dev_ctx *ctx, uint64_t rate)
+{
+    unsigned int wait_cycles = MOD_SYSTEM_PLL_LOCK_TIMEOUT;
+
+    while (!system_pll_is_locked(ctx)) {
+        if (wait_cycles-- == 0)
+            return FWK_E_TIMEOUT;
+    }
+
+    ctx->current_rate = rate;
+
+    return FWK_SUCCESS;
+}
+
+#ifdef BUILD_HAS_MOD_TIMER
+static bool system_pll_is_async(struct system_pll_dev_ctx *ctx)
+{
+    return fwk_id_type_is_valid(ctx->config->clock_id);
+}
+
+static bool system_pll_has_lock_irq(struct system_pll_dev_ctx *ctx)
+{
+    return ctx->config->has_lock_irq;
+}
+
+/*
+ * Complete the pending rate change, if still pending. Both the lock interrupt
+ * and the alarm may attempt to complete it, only the first one does. The alarm
+ * is left running, it can only be stopped from its own callback.
+ */
+static void system_pll_lock_complete(struct system_pll_dev_ctx *ctx,
+                                     int status)
+{
+    bool pending;
+    unsigned int flags;
+    struct mod_clock_driver_resp_params response;
+
+    flags = fwk_interrupt_global_disable();
+    pending = ctx->lock_pending;
+    ctx->lock_pending = false;
+    fwk_interrupt_global_enable(flags);
+
+    if (!pending)
+        return;
+
+    if (system_pll_has_lock_irq(ctx))
+        fwk_interrupt_disable(ctx->config->lock_irq);
+
+    if (status == FWK_SUCCESS)
+        ctx->current_rate = ctx->pending_rate;
+
+    response.status = status;
+    response.value.rate = ctx->current_rate;
+    ctx->response_api->request_complete(ctx->config->clock_id, &response);
+}
+
+static void system_pll_lock_poll(uintptr_t param)
+{
+    int status;
+    struct system_pll_dev_ctx *ctx = module_ctx.dev_ctx_table + param;
+
+    if (ctx->lock_pending) {
+        if (system_pll_is_locked(ctx))
+            system_pll_lock_complete(ctx, FWK_SUCCESS);
+        else if (ctx->lock_polls_left-- == 0)
+            system_pll_lock_complete(ctx, FWK_E_TIMEOUT);
+        else
+            return;
+    }
+
+    /* The rate change completed, here or from the lock interrupt */
+    status = ctx->alarm_api->stop(ctx->config->alarm_id);
+    if (status != FWK_SUCCESS)
+        FWK_LOG_ERR("[SYSTEM_PLL] Failed to stop the lock alarm: %d", status);
+}
+
+static void system_pll_lock_isr(uintptr_t param)
+{
+    struct system_pll_dev_ctx *ctx = module_ctx.dev_ctx_table + param;
+
+    fwk_interrupt_clear_pending(ctx->config->lock_irq);
+
+    if (system_pll_is_locked(ctx))
+        system_pll_lock_complete(ctx, FWK_SUCCESS);
+}
+
+/*
+ * Wait for the PLL to lock without blocking. The rate change completes through
+ * the clock driver response API, from the lock interrupt or the alarm.
+ */
+static int system_pll_wait_lock_async(struct system_pll_dev_ctx *ctx,
+                                      uint64_t rate)
+{
+    int status;
+    uint32_t lock_timeout_ms;
+
+    lock_timeout_ms = ctx->config->lock_timeout_ms;
+    if (lock_timeout_ms == 0)
+        lock_timeout_ms = MOD_SYSTEM_PLL_LOCK_TIMEOUT_MS;
+
+    ctx->pending_rate = rate;
+    ctx->lock_polls_left = lock_timeout_ms / MOD_SYSTEM_PLL_LOCK_POLL_PERIOD_MS;
+    ctx->lock_pending = true;
+
+    status = ctx->alarm_api->start(ctx->config->alarm_id,
+                                   MOD_SYSTEM_PLL_LOCK_POLL_PERIOD_MS,
+                                   MOD_TIMER_ALARM_TYPE_PERIODIC,
+                                   system_pll_lock_poll,
+                                   (uintptr_t)(ctx - module_ctx.dev_ctx_table));
+    if (status != FWK_SUCCESS) {
+        ctx->lock_pending = false;
+        return status;
+    }
+
+    /* The alarm alone completes the rate change should this fail */
+    if (system_pll_has_lock_irq(ctx))
+        (void)fwk_interrupt_enable(ctx->config->lock_irq);
+
+    return FWK_PENDING;
+}
+#endif
+
+static int system_pll_program(struct system_pll_dev_ctx *ctx, uint64_t rate,
+                              enum mod_clock_round_mode round_mode,
+                              bool async)
 {
     uint64_t rounded_rate;
     uint64_t rounded_rate_alt;
     unsigned int picoseconds;
-    struct system_pll_dev_ctx *ctx;
-
-    if (!fwk_module_is_valid_element_id(dev_id))
-    return FWK_E_PARAM;
-
-    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(dev_id);
 
     if (ctx->current_state == MOD_CLOCK_STATE_STOPPED)
         return FWK_E_PWRSTATE;
 
+#ifdef BUILD_HAS_MOD_TIMER
+    if (ctx->lock_pending)
+        return FWK_E_BUSY;
+#endif
+
     /* If the given rate is not attainable as-is then round as requested */
     if ((rate % ctx->config->min_step) > 0) {
         switch (round_mode) {
@@ -129,22 +320,41 @@ static int system_pll_set_rate(fwk_id_t dev_id, uint64_t rate,
     if (rounded_rate > ctx->config->max_rate)
         return FWK_E_RANGE;
 
-    picoseconds = freq_to_half_cycle_ps(rounded_rate);
+    picoseconds =
+        freq_to_half_cycle_ps(system_pll_programmed_rate(ctx, rounded_rate));
 
     if (picoseconds == 0)
         return FWK_E_RANGE;
 
     *ctx->config->control_reg = picoseconds;
 
-    if (ctx->config->status_reg != NULL) {
-        /* Wait until the PLL has locked */
-        while ((*ctx->config->status_reg & ctx->config->lock_flag_mask) == 0)
-            continue;
-    }
+#ifdef BUILD_HAS_MOD_TIMER
+    if (async && !system_pll_is_locked(ctx))
+        return system_pll_wait_lock_async(ctx, rounded_rate);
+#endif
 
-    ctx->current_rate = rounded_rate;
+    return system_pll_wait_lock(ctx, rounded_rate);
+}
 
-    return FWK_SUCCESS;
+/*
+ * Clock driver API functions
+ */
+
+static int system_pll_set_rate(fwk_id_t dev_id, uint64_t rate,
+                               enum mod_clock_round_mode round_mode)
+{
+    struct system_pll_dev_ctx *ctx;
+
+    if (!fwk_module_is_valid_element_id(dev_id))
+        return FWK_E_PARAM;
+
+    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(dev_id);
+
+#ifdef BUILD_HAS_MOD_TIMER
+    return system_pll_program(ctx, rate, round_mode, system_pll_is_async(ctx));
+#else
+    return system_pll_program(ctx, rate, round_mode, false);
+#endif
 }
 
 static int system_pll_get_rate(fwk_id_t dev_id, uint64_t *rate)
@@ -236,7 +446,7 @@ static int system_pll_power_state_change(
         rate = ctx->config->initial_rate;
     }
 
-    return system_pll_set_rate(dev_id, rate, MOD_CLOCK_ROUND_MODE_NONE);
+    return system_pll_program(ctx, rate, MOD_CLOCK_ROUND_MODE_NONE, false);
 }
 
 static int system_pll_power_state_pending_change(
@@ -251,11 +461,72 @@ static int system_pll_power_state_pending_change(
     if (next_state == MOD_PD_STATE_OFF) {
         /* Just mark the PLL as stopped */
         ctx->current_state = MOD_CLOCK_STATE_STOPPED;
+
+#ifdef BUILD_HAS_MOD_TIMER
+        /* The PLL will not lock anymore, abort the pending rate change */
+        if (ctx->lock_pending)
+            system_pll_lock_complete(ctx, FWK_E_PWRSTATE);
+#endif
     }
 
     return FWK_SUCCESS;
 }
 
+/*
+ * Spread spectrum API functions
+ */
+
+static int system_pll_get_spread(fwk_id_t dev_id,
+                                 struct mod_system_pll_spread *spread)
+{
+    struct system_pll_dev_ctx *ctx;
+
+    if (!fwk_module_is_valid_element_id(dev_id))
+        return FWK_E_PARAM;
+    if (spread == NULL)
+        return FWK_E_PARAM;
+
+    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(dev_id);
+    *spread = ctx->spread;
+
+    return FWK_SUCCESS;
+}
+
+static int system_pll_set_spread(fwk_id_t dev_id,
+                                 const struct mod_system_pll_spread *spread)
+{
+    struct system_pll_dev_ctx *ctx;
+
+    if (!fwk_module_is_valid_element_id(dev_id))
+        return FWK_E_PARAM;
+    if ((spread == NULL) || (spread->mode >= MOD_SYSTEM_PLL_SPREAD_MODE_COUNT))
+        return FWK_E_PARAM;
+    if (spread->depth_ppm > MOD_SYSTEM_PLL_SPREAD_MAX_DEPTH_PPM)
+        return FWK_E_RANGE;
+
+    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(dev_id);
+
+#ifdef BUILD_HAS_MOD_TIMER
+    if (ctx->lock_pending)
+        return FWK_E_BUSY;
+#endif
+
+    ctx->spread = *spread;
+
+    /* The new modulation is accounted for when the PLL is next programmed */
+    if (!ctx->initialized || (ctx->current_state == MOD_CLOCK_STATE_STOPPED))
+        return FWK_SUCCESS;
+
+    /* Keep the average rate with the new modulation */
+    return system_pll_program(ctx, ctx->current_rate,
+                              MOD_CLOCK_ROUND_MODE_NONE, false);
+}
+
+static const struct mod_system_pll_spread_api api_system_pll_spread = {
+    .get_spread = system_pll_get_spread,
+    .set_spread = system_pll_set_spread,
+};
+
 static const struct mod_clock_drv_api api_system_pll = {
     .set_rate = system_pll_set_rate,
     .get_rate = system_pll_get_rate,
@@ -294,19 +565,88 @@ static int system_pll_element_init(fwk_id_t element_id, unsigned int unused,
 
     ctx->config = dev_config;
 
+    if (!system_pll_spread_is_valid(&dev_config->spread))
+        return FWK_E_DATA;
+    ctx->spread = dev_config->spread;
+
+#ifdef BUILD_HAS_MOD_TIMER
+    /* The asynchronous rate changes need the alarm to bound the lock wait */
+    if (system_pll_is_async(ctx) && !fwk_id_type_is_valid(dev_config->alarm_id))
+        return FWK_E_DATA;
+#else
+    /* The asynchronous rate changes need the timer module */
+    if (fwk_id_type_is_valid(dev_config->clock_id))
+        return FWK_E_SUPPORT;
+#endif
+
     if (ctx->config->defer_initialization)
         return FWK_SUCCESS;
 
     ctx->initialized = true;
     ctx->current_state = MOD_CLOCK_STATE_RUNNING;
-    return system_pll_set_rate(element_id, ctx->config->initial_rate,
-                                MOD_CLOCK_ROUND_MODE_NONE);
+    return system_pll_program(ctx, ctx->config->initial_rate,
+                              MOD_CLOCK_ROUND_MODE_NONE, false);
+}
+
+#ifdef BUILD_HAS_MOD_TIMER
+static int system_pll_bind(fwk_id_t id, unsigned int round)
+{
+    int status;
+    struct system_pll_dev_ctx *ctx;
+
+    if ((round > 0) || !fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
+        return FWK_SUCCESS;
+
+    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(id);
+
+    if (!system_pll_is_async(ctx))
+        return FWK_SUCCESS;
+
+    status = fwk_module_bind(ctx->config->clock_id,
+        FWK_ID_API(FWK_MODULE_IDX_CLOCK, MOD_CLOCK_API_TYPE_DRIVER_RESPONSE),
+        &ctx->response_api);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    return fwk_module_bind(ctx->config->alarm_id, MOD_TIMER_API_ID_ALARM,
+                           &ctx->alarm_api);
 }
 
+static int system_pll_start(fwk_id_t id)
+{
+    struct system_pll_dev_ctx *ctx;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
+        return FWK_SUCCESS;
+
+    ctx = module_ctx.dev_ctx_table + fwk_id_get_element_idx(id);
+
+    if (!system_pll_is_async(ctx) || !system_pll_has_lock_irq(ctx))
+        return FWK_SUCCESS;
+
+    /* The interrupt is only enabled while a rate change is pending */
+    return fwk_interrupt_set_isr_param(ctx->config->lock_irq,
+                                       system_pll_lock_isr,
+                                       fwk_id_get_element_idx(id));
+}
+#endif
+
 static int system_pll_process_bind_request(fwk_id_t requester_id, fwk_id_t id,
                                         fwk_id_t api_type, const void **api)
 {
-    *api = &api_system_pll;
+    switch (fwk_id_get_api_idx(api_type)) {
+    case MOD_SYSTEM_PLL_API_TYPE_DEFAULT:
+        *api = &api_system_pll;
+        break;
+
+    case MOD_SYSTEM_PLL_API_TYPE_SPREAD:
+        *api = &api_system_pll_spread;
+        break;
+
+    default:
+        return FWK_E_PARAM;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -316,5 +656,9 @@ const struct fwk_module module_system_pll = {
     .event_count = 0,
     .init = system_pll_init,
     .element_init = system_pll_element_init,
+#ifdef BUILD_HAS_MOD_TIMER
+    .bind = system_pll_bind,
+    .start = system_pll_start,
+#endif
     .process_bind_request = system_pll_process_bind_request,
 };
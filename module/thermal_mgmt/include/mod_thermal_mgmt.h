@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -35,6 +35,14 @@ enum mod_thermal_api_idx {
      */
     MOD_THERMAL_API_PERF_UPDATE_IDX,
 
+    /*!
+     * \brief Emergency API index.
+     *
+     * \note This API implements the ::mod_thermal_mgmt_emergency_api
+     *      interface.
+     */
+    MOD_THERMAL_API_EMERGENCY_IDX,
+
     MOD_THERMAL_API_COUNT,
 };
 
@@ -108,6 +116,48 @@ struct mod_thermal_mgmt_protection_config {
     uint32_t crit_temp_threshold;
 };
 
+/*!
+ * \brief Thermal Mgmt emergency configuration.
+ *
+ * \details Configuration structure for the fast-response emergency path.
+ *      When the temperature reaches the trip temperature, precomputed
+ *      emergency performance limits are applied to the actors straight away,
+ *      without waiting for the slow loop. They are kept until the temperature
+ *      falls below the release temperature.
+ */
+struct mod_thermal_mgmt_emergency_config {
+    /*! Temperature at or above which the emergency limits are applied */
+    uint32_t trip_temperature;
+
+    /*!
+     * \brief Temperature below which the emergency limits are released.
+     *
+     * \details It must be lower than `trip_temperature`. The difference
+     *      between the two temperatures is the hysteresis of the emergency
+     *      path.
+     */
+    uint32_t release_temperature;
+
+    /*!
+     * \brief Emergency power.
+     *
+     * \details The power shared between the actors according to their weight
+     *      during an emergency. The emergency performance limit of each actor
+     *      is computed from its share through the power model at start.
+     */
+    uint32_t power;
+
+    /*!
+     * \brief Emergency check multiplier.
+     *
+     * \details The temperature is checked against the trip temperature every
+     *      `check_mult` performance update periods, in addition to the slow
+     *      loop readings. If it is left zero, the emergency path is only
+     *      triggered by the slow loop readings and the emergency API.
+     */
+    unsigned int check_mult;
+};
+
 /*!
  * \brief Thermal Mgmt device configuration.
  *
@@ -196,6 +246,14 @@ struct mod_thermal_mgmt_dev_config {
      */
     struct mod_thermal_mgmt_protection_config *temp_protection;
 
+    /*!
+     * \brief Emergency configuration.
+     *
+     * \details It is an optional feature that requires at least one actor. If
+     *      it is left NULL it will not operate.
+     */
+    struct mod_thermal_mgmt_emergency_config *emergency;
+
     /*! Power Model API identifier */
     fwk_id_t driver_api_id;
 
@@ -300,6 +358,33 @@ struct mod_thermal_mgmt_activity_factor_api {
     int (*get_activity_factor)(fwk_id_t domain_id, uint16_t *activity);
 };
 
+/*!
+ * \brief Thermal management emergency API.
+ *
+ * \details This API can be used by a platform driver handling the temperature
+ *      trip interrupts of a sensor.
+ */
+struct mod_thermal_mgmt_emergency_api {
+    /*!
+     * \brief Report a temperature trip.
+     *
+     * \details Requests the emergency performance limits of the thermal
+     *      device to be applied. The limits are released once a temperature
+     *      reading falls below the release temperature.
+     *
+     * \note This function can be called from an interrupt handler.
+     *
+     * \param thermal_id Specific thermal management controller device
+     *      identifier.
+     *
+     * \retval ::FWK_E_PARAM The device has no emergency configuration.
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     *
+     * \return Status code representing the result of the operation.
+     */
+    int (*trip)(fwk_id_t thermal_id);
+};
+
 /*!
  * \}
  */
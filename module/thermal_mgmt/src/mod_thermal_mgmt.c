@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -20,6 +20,12 @@ static const fwk_id_t mod_thermal_event_id_read_temp = FWK_ID_EVENT_INIT(
     MOD_THERMAL_EVENT_IDX_READ_TEMP);
 #endif
 
+static const fwk_id_t mod_thermal_event_id_trip =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, MOD_THERMAL_EVENT_IDX_TRIP);
+
+static const fwk_id_t mod_thermal_emergency_api_id =
+    FWK_ID_API_INIT(FWK_MODULE_IDX_THERMAL_MGMT, MOD_THERMAL_API_EMERGENCY_IDX);
+
 static struct mod_thermal_mgmt_ctx mod_ctx;
 
 struct mod_thermal_mgmt_dev_ctx *get_dev_ctx(fwk_id_t id)
@@ -124,6 +130,179 @@ static void thermal_protection(struct mod_thermal_mgmt_dev_ctx *dev_ctx)
     }
 }
 
+/*
+ * Emergency path.
+ * The emergency limits are applied through the plugin handler as soon as the
+ * temperature trips, and are enforced on every fast loop until the temperature
+ * is back below the release threshold.
+ *
+ * The plugin handler must not be called back from the update callback, so the
+ * limits are always applied from the trip event. A trip detected during an
+ * update is enforced by that same update through the adjusted limits.
+ */
+static int emergency_engage(struct mod_thermal_mgmt_dev_ctx *dev_ctx)
+{
+    struct mod_thermal_mgmt_actor_ctx *actor_ctx;
+    unsigned int actor;
+    int status, engage_status = FWK_SUCCESS;
+
+    if (!dev_ctx->emergency_active) {
+        dev_ctx->emergency_active = true;
+
+        FWK_LOG_WARN(
+            "[THERMAL][%s] temp (%u) emergency limits applied",
+            fwk_module_get_element_name(dev_ctx->id),
+            (unsigned int)dev_ctx->cur_temp);
+    }
+
+    for (actor = 0; actor < dev_ctx->config->thermal_actors_count; actor++) {
+        actor_ctx = get_actor_ctx(dev_ctx, actor);
+
+        struct plugin_limits_req limits_req = {
+            .domain_id = actor_ctx->config->dvfs_domain_id,
+            .max_limit = actor_ctx->emergency_perf_limit,
+            .min_limit = actor_ctx->emergency_min_limit,
+        };
+
+        status = dev_ctx->perf_plugins_handler_api->plugin_set_limits(
+            &limits_req);
+        if (status != FWK_SUCCESS) {
+            FWK_LOG_ERR(
+                "[THERMAL] Failed to apply emergency limit (%u,%u)",
+                fwk_id_get_element_idx(dev_ctx->id),
+                actor);
+
+            if (engage_status == FWK_SUCCESS) {
+                engage_status = status;
+            }
+        }
+    }
+
+    return engage_status;
+}
+
+static int emergency_request(fwk_id_t thermal_id)
+{
+    struct fwk_event_light event = {
+        .source_id = thermal_id,
+        .target_id = thermal_id,
+        .id = mod_thermal_event_id_trip,
+    };
+
+    return fwk_put_event(&event);
+}
+
+static void emergency_check(struct mod_thermal_mgmt_dev_ctx *dev_ctx)
+{
+    const struct mod_thermal_mgmt_emergency_config *emergency;
+    int status;
+
+    emergency = dev_ctx->config->emergency;
+
+    if (!dev_ctx->emergency_active) {
+        if (dev_ctx->cur_temp >= emergency->trip_temperature) {
+            dev_ctx->emergency_active = true;
+
+            FWK_LOG_WARN(
+                "[THERMAL][%s] temp (%u) emergency limits applied",
+                fwk_module_get_element_name(dev_ctx->id),
+                (unsigned int)dev_ctx->cur_temp);
+
+            status = emergency_request(dev_ctx->id);
+            if (status != FWK_SUCCESS) {
+                /* The limits are still enforced by the next update */
+                FWK_LOG_ERR(
+                    "[THERMAL] Failed to request emergency limits (%u)",
+                    fwk_id_get_element_idx(dev_ctx->id));
+            }
+        }
+    } else if (dev_ctx->cur_temp < emergency->release_temperature) {
+        dev_ctx->emergency_active = false;
+
+        FWK_LOG_INFO(
+            "[THERMAL][%s] temp (%u) emergency limits released",
+            fwk_module_get_element_name(dev_ctx->id),
+            (unsigned int)dev_ctx->cur_temp);
+    }
+}
+
+static void emergency_limit(
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx,
+    uint32_t *perf_limit)
+{
+    struct mod_thermal_mgmt_actor_ctx *actor_ctx;
+    unsigned int actor, dom;
+
+    for (actor = 0; actor < dev_ctx->config->thermal_actors_count; actor++) {
+        actor_ctx = get_actor_ctx(dev_ctx, actor);
+        dom = fwk_id_get_element_idx(actor_ctx->config->dvfs_domain_id);
+
+        if (actor_ctx->emergency_perf_limit < perf_limit[dom]) {
+            perf_limit[dom] = actor_ctx->emergency_perf_limit;
+        }
+    }
+}
+
+/*
+ * Compute the emergency performance limits once, so that the emergency path
+ * does not need to run the power model.
+ */
+static int emergency_precompute(struct mod_thermal_mgmt_dev_ctx *dev_ctx)
+{
+    struct mod_thermal_mgmt_actor_ctx *actor_ctx;
+    struct mod_dvfs_opp opp;
+    uint64_t power;
+    uint32_t sum_weights = 0;
+    unsigned int actor;
+    int status;
+
+    for (actor = 0; actor < dev_ctx->config->thermal_actors_count; actor++) {
+        sum_weights += get_actor_ctx(dev_ctx, actor)->config->weight;
+    }
+
+    for (actor = 0; actor < dev_ctx->config->thermal_actors_count; actor++) {
+        actor_ctx = get_actor_ctx(dev_ctx, actor);
+
+        if (sum_weights == 0) {
+            power = dev_ctx->config->emergency->power /
+                dev_ctx->config->thermal_actors_count;
+        } else {
+            power = ((uint64_t)dev_ctx->config->emergency->power *
+                     actor_ctx->config->weight) /
+                sum_weights;
+        }
+
+        actor_ctx->emergency_perf_limit = dev_ctx->driver_api->power_to_level(
+            actor_ctx->config->driver_id, (uint32_t)power);
+
+        /* The operating points are in ascending order */
+        status = dev_ctx->dvfs_api->get_nth_opp(
+            actor_ctx->config->dvfs_domain_id, 0, &opp);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        actor_ctx->emergency_min_limit = opp.level;
+    }
+
+    return FWK_SUCCESS;
+}
+
+/* Called each time a new temperature is available */
+static void temperature_update(struct mod_thermal_mgmt_dev_ctx *dev_ctx)
+{
+    dev_ctx->read_pending = false;
+
+    if (dev_ctx->config->emergency != NULL) {
+        emergency_check(dev_ctx);
+    }
+
+    if (dev_ctx->control_read) {
+        dev_ctx->control_read = false;
+        dev_ctx->control_needs_update = true;
+    }
+}
+
 static int read_temperature(fwk_id_t id)
 {
 #if THERMAL_HAS_ASYNC_SENSORS
@@ -146,16 +325,44 @@ static int read_temperature(fwk_id_t id)
     if (status == FWK_SUCCESS) {
         dev_ctx->cur_temp = (uint32_t)dev_ctx->sensor_data.value;
 
-        dev_ctx->control_needs_update = true;
+        temperature_update(dev_ctx);
     }
 
     return status;
 #endif
 }
 
+/*
+ * Start a temperature reading, unless one is already in progress in which
+ * case its result is used.
+ */
+static int start_reading(struct mod_thermal_mgmt_dev_ctx *dev_ctx, bool control)
+{
+    int status;
+
+    if (control) {
+        dev_ctx->control_read = true;
+    }
+
+    if (dev_ctx->read_pending) {
+        return FWK_SUCCESS;
+    }
+
+    dev_ctx->read_pending = true;
+
+    status = read_temperature(dev_ctx->id);
+    if (status != FWK_SUCCESS) {
+        dev_ctx->read_pending = false;
+        dev_ctx->control_read = false;
+    }
+
+    return status;
+}
+
 static int control_update(fwk_id_t id)
 {
     struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    const struct mod_thermal_mgmt_emergency_config *emergency;
     int status;
 
     dev_ctx = get_dev_ctx(id);
@@ -178,12 +385,26 @@ static int control_update(fwk_id_t id)
          *
          * Either way we need to attempt to continue to process the loop.
          */
-        status = read_temperature(id);
+        status = start_reading(dev_ctx, true);
         if (status != FWK_SUCCESS) {
             return FWK_E_DEVICE;
         }
     }
 
+    emergency = dev_ctx->config->emergency;
+    if ((emergency != NULL) && (emergency->check_mult > 0)) {
+        dev_ctx->emergency_tick_counter++;
+        if (dev_ctx->emergency_tick_counter >= emergency->check_mult) {
+            dev_ctx->emergency_tick_counter = 0;
+
+            /* Fast check: only the emergency path uses this reading */
+            status = start_reading(dev_ctx, false);
+            if (status != FWK_SUCCESS) {
+                return FWK_E_DEVICE;
+            }
+        }
+    }
+
     if (dev_ctx->control_needs_update) {
         dev_ctx->control_needs_update = false;
         if (dev_ctx->config->thermal_actors_count > 0) {
@@ -223,6 +444,9 @@ static int thermal_update(struct perf_plugins_perf_update *data)
         if (dev_ctx->config->thermal_actors_count > 0) {
             distribute_power(dev_ctx->id, data->level, data->adj_max_limit);
         }
+        if (dev_ctx->emergency_active) {
+            emergency_limit(dev_ctx, data->adj_max_limit);
+        }
     }
 
     return FWK_SUCCESS;
@@ -232,6 +456,23 @@ struct perf_plugins_api mod_thermal_perf_plugins_api = {
     .update = thermal_update,
 };
 
+static int thermal_trip(fwk_id_t thermal_id)
+{
+    if (!fwk_module_is_valid_element_id(thermal_id)) {
+        return FWK_E_PARAM;
+    }
+
+    if (get_dev_ctx(thermal_id)->config->emergency == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    return emergency_request(thermal_id);
+}
+
+static struct mod_thermal_mgmt_emergency_api emergency_api = {
+    .trip = thermal_trip,
+};
+
 /*
  * Framework handler functions.
  */
@@ -269,6 +510,13 @@ static int thermal_mgmt_dev_init(
     dev_ctx->config = config;
     dev_ctx->id = element_id;
 
+    if ((config->emergency != NULL) &&
+        ((config->thermal_actors_count == 0) ||
+         (config->emergency->release_temperature >=
+          config->emergency->trip_temperature))) {
+        return FWK_E_PARAM;
+    }
+
     if (dev_ctx->config->thermal_actors_count > 0) {
         /* Assume TDP until PI loop is updated */
         dev_ctx->thermal_allocatable_power = (uint32_t)dev_ctx->config->tdp;
@@ -370,6 +618,43 @@ static int thermal_mgmt_bind(fwk_id_t id, unsigned int round)
         }
     }
 
+    if (dev_ctx->config->emergency != NULL) {
+        /* Bind to the plugin handler to apply the emergency limits */
+        status = fwk_module_bind(
+            FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+            FWK_ID_API(FWK_MODULE_IDX_SCMI_PERF, MOD_SCMI_PERF_PLUGINS_API),
+            &dev_ctx->perf_plugins_handler_api);
+        if (status != FWK_SUCCESS) {
+            return FWK_E_PANIC;
+        }
+
+        /* Bind to DVFS to get the lowest operating point of the actors */
+        status = fwk_module_bind(
+            FWK_ID_MODULE(FWK_MODULE_IDX_DVFS),
+            mod_dvfs_api_id_dvfs,
+            &dev_ctx->dvfs_api);
+        if (status != FWK_SUCCESS) {
+            return FWK_E_PANIC;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int thermal_mgmt_start(fwk_id_t id)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return FWK_SUCCESS;
+    }
+
+    dev_ctx = get_dev_ctx(id);
+
+    if (dev_ctx->config->emergency != NULL) {
+        return emergency_precompute(dev_ctx);
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -379,12 +664,15 @@ static int thermal_mgmt_process_bind_request(
     fwk_id_t api_id,
     const void **thermal_bind_request_api)
 {
-    *thermal_bind_request_api = &mod_thermal_perf_plugins_api;
+    if (fwk_id_is_equal(api_id, mod_thermal_emergency_api_id)) {
+        *thermal_bind_request_api = &emergency_api;
+    } else {
+        *thermal_bind_request_api = &mod_thermal_perf_plugins_api;
+    }
 
     return FWK_SUCCESS;
 }
 
-#if THERMAL_HAS_ASYNC_SENSORS
 static int thermal_mgmt_process_event(
     const struct fwk_event *event,
     struct fwk_event *resp_event)
@@ -394,6 +682,7 @@ static int thermal_mgmt_process_event(
 
     dev_ctx = get_dev_ctx(event->target_id);
 
+#if THERMAL_HAS_ASYNC_SENSORS
     if (fwk_id_is_equal(event->id, mod_thermal_event_id_read_temp)) {
         /* Temperature-reading event */
         status = dev_ctx->sensor_api->get_data(
@@ -409,19 +698,32 @@ static int thermal_mgmt_process_event(
         } else {
             status = FWK_E_DEVICE;
         }
+    } else if (fwk_id_is_equal(event->id, mod_thermal_event_id_trip)) {
+        /* Temperature trip, from a reading or the emergency API */
+        return emergency_engage(dev_ctx);
     } else {
         status = FWK_E_PARAM;
     }
 
     if (status == FWK_SUCCESS) {
-        dev_ctx->control_needs_update = true;
+        temperature_update(dev_ctx);
     } else if (status == FWK_PENDING) {
         status = FWK_SUCCESS;
+    } else {
+        dev_ctx->read_pending = false;
+        dev_ctx->control_read = false;
     }
 
     return status;
-}
+#else
+    if (fwk_id_is_equal(event->id, mod_thermal_event_id_trip)) {
+        /* Temperature trip, from a reading or the emergency API */
+        return emergency_engage(dev_ctx);
+    }
+
+    return FWK_E_PARAM;
 #endif
+}
 
 const struct fwk_module module_thermal_mgmt = {
     .type = FWK_MODULE_TYPE_SERVICE,
@@ -430,8 +732,7 @@ const struct fwk_module module_thermal_mgmt = {
     .init = thermal_mgmt_init,
     .element_init = thermal_mgmt_dev_init,
     .bind = thermal_mgmt_bind,
+    .start = thermal_mgmt_start,
     .process_bind_request = thermal_mgmt_process_bind_request,
-#if THERMAL_HAS_ASYNC_SENSORS
     .process_event = thermal_mgmt_process_event,
-#endif
 };
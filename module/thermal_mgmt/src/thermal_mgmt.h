@@ -8,6 +8,7 @@
 #ifndef THERMAL_MGMT_H
 #define THERMAL_MGMT_H
 
+#include <mod_dvfs.h>
 #include <mod_scmi_perf.h>
 #include <mod_sensor.h>
 #include <mod_thermal_mgmt.h>
@@ -27,6 +28,7 @@
 
 enum mod_thermal_mgmt_event_idx {
     MOD_THERMAL_EVENT_IDX_READ_TEMP,
+    MOD_THERMAL_EVENT_IDX_TRIP,
 
     MOD_THERMAL_EVENT_IDX_COUNT,
 };
@@ -49,6 +51,12 @@ struct mod_thermal_mgmt_actor_ctx {
 
     /* Activity factor API */
     struct mod_thermal_mgmt_activity_factor_api *activity_api;
+
+    /* Performance limit applied during an emergency */
+    uint32_t emergency_perf_limit;
+
+    /* Lowest performance level of the domain, requested during an emergency */
+    uint32_t emergency_min_limit;
 };
 
 struct mod_thermal_mgmt_dev_ctx {
@@ -67,6 +75,24 @@ struct mod_thermal_mgmt_dev_ctx {
     /* Does the PI loop need update */
     bool control_needs_update;
 
+    /* Is a temperature reading in progress */
+    bool read_pending;
+
+    /* Is the reading in progress for the PI loop */
+    bool control_read;
+
+    /* Tick counter for the emergency check */
+    unsigned int emergency_tick_counter;
+
+    /* Are the emergency limits applied */
+    bool emergency_active;
+
+    /* Plugin handler API, used to apply the emergency limits */
+    struct perf_plugins_handler_api *perf_plugins_handler_api;
+
+    /* DVFS API, used to get the lowest operating point of the actors */
+    const struct mod_dvfs_domain_api *dvfs_api;
+
     /* Sensor API */
     const struct mod_sensor_api *sensor_api;
 
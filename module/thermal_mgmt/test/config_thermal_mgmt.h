@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -110,6 +110,13 @@ static struct mod_thermal_mgmt_protection_config temp_protection = {
     .crit_temp_threshold = 80,
 };
 
+static struct mod_thermal_mgmt_emergency_config emergency = {
+    .trip_temperature = 90,
+    .release_temperature = 80,
+    .power = 40,
+    .check_mult = 1,
+};
+
 static const struct mod_thermal_mgmt_dev_config
     dev_config_default_table[MOD_THERMAL_MGMT_DOM_COUNT] = {
     [MOD_THERMAL_MGMT_DOM_0] = {
@@ -189,6 +196,54 @@ static struct mod_sensor_api sensor_api = {
     .get_data = mod_sensor_get_data,
 };
 
+static unsigned int plugin_set_limits_count;
+static uint32_t plugin_set_limits_max[FAKE_ACTOR_PER_DOMAIN];
+static uint32_t plugin_set_limits_min[FAKE_ACTOR_PER_DOMAIN];
+static int plugin_set_limits_status;
+
+static int fake_plugin_set_limits(struct plugin_limits_req *data)
+{
+    plugin_set_limits_min[plugin_set_limits_count] = data->min_limit;
+    plugin_set_limits_max[plugin_set_limits_count++] = data->max_limit;
+
+    return plugin_set_limits_status;
+}
+
+static struct perf_plugins_handler_api perf_plugins_handler_api = {
+    .plugin_set_limits = fake_plugin_set_limits,
+};
+
+static uint32_t fake_level_to_power(fwk_id_t domain_id, const uint32_t level)
+{
+    return level;
+}
+
+static uint32_t fake_power_to_level(fwk_id_t domain_id, const uint32_t power)
+{
+    return power / 2;
+}
+
+static struct mod_thermal_mgmt_driver_api driver_api = {
+    .level_to_power = fake_level_to_power,
+    .power_to_level = fake_power_to_level,
+};
+
+#define FAKE_LOWEST_OPP_LEVEL 5
+
+static int fake_get_nth_opp(
+    fwk_id_t domain_id,
+    size_t n,
+    struct mod_dvfs_opp *opp)
+{
+    opp->level = FAKE_LOWEST_OPP_LEVEL + n;
+
+    return FWK_SUCCESS;
+}
+
+static struct mod_dvfs_domain_api dvfs_api = {
+    .get_nth_opp = fake_get_nth_opp,
+};
+
 static struct mod_thermal_mgmt_dev_ctx
     dev_ctx_table[MOD_THERMAL_MGMT_DOM_COUNT];
 
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2022-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -55,6 +55,9 @@ void setUp(void)
         dev_ctx->actor_ctx_table = &actor_ctx_table[dev_idx][0];
         dev_ctx->thermal_protection_api = &thermal_protection_api;
         dev_ctx->sensor_api = &sensor_api;
+        dev_ctx->driver_api = &driver_api;
+        dev_ctx->perf_plugins_handler_api = &perf_plugins_handler_api;
+        dev_ctx->dvfs_api = &dvfs_api;
 
         /* Configure actors context */
         for (actor_idx = 0; actor_idx < dev_ctx->config->thermal_actors_count;
@@ -65,6 +68,9 @@ void setUp(void)
             actor_ctx->config = &(config->thermal_actors_table[actor_idx]);
         }
     }
+
+    plugin_set_limits_count = 0;
+    plugin_set_limits_status = FWK_SUCCESS;
 }
 
 void tearDown(void)
@@ -267,17 +273,85 @@ void test_thermal_mgmt_bind_success(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+void test_thermal_mgmt_bind_emergency(void)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0);
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    struct mod_thermal_mgmt_actor_ctx *actor_ctx;
+    int status;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    actor_ctx = &dev_ctx->actor_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+
+    fwk_id_is_type_ExpectAndReturn(element_id, FWK_ID_TYPE_MODULE, false);
+    fwk_id_get_element_idx_ExpectAndReturn(element_id, 0);
+    fwk_module_bind_ExpectAndReturn(
+        dev_ctx->config->sensor_id,
+        mod_sensor_api_id_sensor,
+        &dev_ctx->sensor_api,
+        FWK_SUCCESS);
+    fwk_module_bind_ExpectAndReturn(
+        dev_ctx->config->temp_protection->driver_id,
+        dev_ctx->config->temp_protection->driver_api_id,
+        &dev_ctx->thermal_protection_api,
+        FWK_SUCCESS);
+    fwk_id_get_module_idx_ExpectAndReturn(
+        dev_ctx->config->driver_api_id, FWK_MODULE_IDX_FAKE_POWER_MODEL);
+    fwk_module_bind_ExpectAndReturn(
+        fwk_module_id_fake_power_model,
+        dev_ctx->config->driver_api_id,
+        &dev_ctx->driver_api,
+        FWK_SUCCESS);
+    fwk_module_bind_ExpectAndReturn(
+        actor_ctx->config->activity_factor->driver_id,
+        actor_ctx->config->activity_factor->driver_api_id,
+        &actor_ctx->activity_api,
+        FWK_SUCCESS);
+    fwk_module_bind_ExpectAndReturn(
+        FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI_PERF, MOD_SCMI_PERF_PLUGINS_API),
+        &dev_ctx->perf_plugins_handler_api,
+        FWK_SUCCESS);
+    fwk_module_bind_ExpectAndReturn(
+        FWK_ID_MODULE(FWK_MODULE_IDX_DVFS),
+        mod_dvfs_api_id_dvfs,
+        &dev_ctx->dvfs_api,
+        FWK_SUCCESS);
+    status = thermal_mgmt_bind(element_id, 0);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+}
+
 void test_thermal_mgmt_process_bind_request(void)
 {
     struct perf_plugins_api *api;
     int status;
 
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+
     status = thermal_mgmt_process_bind_request(
         FWK_ID_NONE, FWK_ID_NONE, FWK_ID_NONE, (const void **)&api);
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
     TEST_ASSERT_EQUAL(api, &mod_thermal_perf_plugins_api);
 }
 
+void test_thermal_mgmt_process_bind_request_emergency(void)
+{
+    struct mod_thermal_mgmt_emergency_api *api;
+    int status;
+
+    fwk_id_is_equal_ExpectAndReturn(
+        mod_thermal_emergency_api_id, mod_thermal_emergency_api_id, true);
+
+    status = thermal_mgmt_process_bind_request(
+        FWK_ID_NONE,
+        FWK_ID_NONE,
+        mod_thermal_emergency_api_id,
+        (const void **)&api);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(api, &emergency_api);
+}
+
 #if THERMAL_HAS_ASYNC_SENSORS
 void test_thermal_mgmt_process_event_invalid(void)
 {
@@ -291,6 +365,7 @@ void test_thermal_mgmt_process_event_invalid(void)
     fwk_id_get_element_idx_ExpectAndReturn(event.target_id, 0);
     fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
     fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
 
     status = thermal_mgmt_process_event(&event, NULL);
     TEST_ASSERT_EQUAL(status, FWK_E_PARAM);
@@ -385,8 +460,198 @@ void test_thermal_mgmt_process_event_read_request_success(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
     TEST_ASSERT_EQUAL(dev_ctx->cur_temp, dev_ctx->sensor_data.value);
 }
+
+void test_thermal_mgmt_process_event_emergency_trip(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    int status;
+    struct fwk_event event = {
+        .source_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0),
+        .target_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0),
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_THERMAL_MGMT,
+            MOD_THERMAL_EVENT_IDX_TRIP),
+    };
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+    dev_ctx->actor_ctx_table[0].emergency_perf_limit = 10;
+    dev_ctx->actor_ctx_table[1].emergency_perf_limit = 12;
+    dev_ctx->actor_ctx_table[0].emergency_min_limit = FAKE_LOWEST_OPP_LEVEL;
+    dev_ctx->actor_ctx_table[1].emergency_min_limit = FAKE_LOWEST_OPP_LEVEL;
+
+    fwk_id_get_element_idx_ExpectAndReturn(event.target_id, 0);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    fwk_module_get_element_name_ExpectAndReturn(
+        dev_ctx->id, thermal_mgmt_domains_elem_table[0].name);
+
+    status = thermal_mgmt_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_TRUE(dev_ctx->emergency_active);
+    TEST_ASSERT_EQUAL(plugin_set_limits_count, 2);
+    TEST_ASSERT_EQUAL(plugin_set_limits_max[0], 10);
+    TEST_ASSERT_EQUAL(plugin_set_limits_max[1], 12);
+    TEST_ASSERT_EQUAL(plugin_set_limits_min[0], FAKE_LOWEST_OPP_LEVEL);
+    TEST_ASSERT_EQUAL(plugin_set_limits_min[1], FAKE_LOWEST_OPP_LEVEL);
+}
+
+void test_thermal_mgmt_process_event_emergency_trip_fail(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    int status;
+    struct fwk_event event = {
+        .source_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0),
+        .target_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0),
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_THERMAL_MGMT,
+            MOD_THERMAL_EVENT_IDX_TRIP),
+    };
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+    dev_ctx->emergency_active = true;
+    plugin_set_limits_status = FWK_E_PARAM;
+
+    fwk_id_get_element_idx_ExpectAndReturn(event.target_id, 0);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    fwk_id_get_element_idx_ExpectAndReturn(dev_ctx->id, 0);
+    fwk_id_get_element_idx_ExpectAndReturn(dev_ctx->id, 0);
+
+    /* All the actors are attempted, the first failure is reported */
+    status = thermal_mgmt_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(status, FWK_E_PARAM);
+    TEST_ASSERT_EQUAL(plugin_set_limits_count, 2);
+}
+
+void test_thermal_mgmt_process_event_emergency_reading(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    int status;
+    struct fwk_event event = {
+        .source_id = FWK_ID_NONE,
+        .target_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0),
+        .id = FWK_ID_NONE,
+    };
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+    dev_ctx->sensor_data.status = FWK_SUCCESS;
+    dev_ctx->sensor_data.value = 95;
+    dev_ctx->read_pending = true;
+
+    fwk_id_get_element_idx_ExpectAndReturn(event.target_id, 0);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(false);
+    fwk_id_is_equal_ExpectAnyArgsAndReturn(true);
+    fwk_module_get_element_name_ExpectAndReturn(
+        dev_ctx->id, thermal_mgmt_domains_elem_table[0].name);
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = thermal_mgmt_process_event(&event, NULL);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_TRUE(dev_ctx->emergency_active);
+    TEST_ASSERT_FALSE(dev_ctx->read_pending);
+
+    /* The limits are applied from the trip event */
+    TEST_ASSERT_EQUAL(plugin_set_limits_count, 0);
+
+    /* The fast check reading does not update the PI loop */
+    TEST_ASSERT_FALSE(dev_ctx->control_needs_update);
+}
 #endif
 
+void test_thermal_mgmt_emergency_hysteresis(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+    dev_ctx->emergency_active = true;
+
+    /* Between the release and the trip temperatures */
+    dev_ctx->cur_temp = 85;
+    emergency_check(dev_ctx);
+    TEST_ASSERT_TRUE(dev_ctx->emergency_active);
+
+    /* Below the release temperature */
+    dev_ctx->cur_temp = 79;
+    fwk_module_get_element_name_ExpectAndReturn(
+        dev_ctx->id, thermal_mgmt_domains_elem_table[0].name);
+    emergency_check(dev_ctx);
+    TEST_ASSERT_FALSE(dev_ctx->emergency_active);
+
+    /* Back between the two temperatures, the limits are not applied */
+    dev_ctx->cur_temp = 85;
+    emergency_check(dev_ctx);
+    TEST_ASSERT_FALSE(dev_ctx->emergency_active);
+    TEST_ASSERT_EQUAL(plugin_set_limits_count, 0);
+}
+
+/*
+ * A trip detected during a performance update does not call back into the
+ * plugin handler, the limits are applied from the trip event.
+ */
+void test_thermal_mgmt_emergency_check_trip(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+
+    dev_ctx->cur_temp = 90;
+    fwk_module_get_element_name_ExpectAndReturn(
+        dev_ctx->id, thermal_mgmt_domains_elem_table[0].name);
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    emergency_check(dev_ctx);
+    TEST_ASSERT_TRUE(dev_ctx->emergency_active);
+    TEST_ASSERT_EQUAL(plugin_set_limits_count, 0);
+
+    /* Still above the trip temperature, no new request */
+    dev_ctx->cur_temp = 95;
+    emergency_check(dev_ctx);
+    TEST_ASSERT_TRUE(dev_ctx->emergency_active);
+}
+
+void test_thermal_mgmt_emergency_precompute(void)
+{
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    int status;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+
+    /* Equal weights: each actor gets 20 from the emergency power */
+    status = emergency_precompute(dev_ctx);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(dev_ctx->actor_ctx_table[0].emergency_perf_limit, 10);
+    TEST_ASSERT_EQUAL(dev_ctx->actor_ctx_table[1].emergency_perf_limit, 10);
+
+    /* The minimum limit is the lowest operating point */
+    TEST_ASSERT_EQUAL(
+        dev_ctx->actor_ctx_table[0].emergency_min_limit,
+        FAKE_LOWEST_OPP_LEVEL);
+    TEST_ASSERT_EQUAL(
+        dev_ctx->actor_ctx_table[1].emergency_min_limit,
+        FAKE_LOWEST_OPP_LEVEL);
+}
+
+void test_thermal_mgmt_dev_init_error_emergency(void)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0);
+    struct mod_thermal_mgmt_emergency_config invalid_emergency = {
+        .trip_temperature = 80,
+        .release_temperature = 80,
+    };
+    int status;
+
+    dev_config_table[0].emergency = &invalid_emergency;
+    fwk_id_get_element_idx_ExpectAndReturn(element_id, 0);
+
+    status = thermal_mgmt_dev_init(element_id, 0, &dev_config_table[0]);
+    TEST_ASSERT_EQUAL(status, FWK_E_PARAM);
+}
+
 void test_thermal_mgmt_thermal_protection(void)
 {
     struct mod_thermal_mgmt_dev_ctx *dev_ctx;
@@ -654,6 +919,83 @@ void test_thermal_mgmt_thermal_update_fail(void)
     TEST_ASSERT_EQUAL(status, FWK_E_PANIC);
 }
 
+void test_thermal_mgmt_control_update_emergency_check(void)
+{
+    fwk_id_t element_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, 0);
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    int status;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_config_table[0].emergency = &emergency;
+
+    fwk_id_get_element_idx_ExpectAndReturn(element_id, 0);
+#if THERMAL_HAS_ASYNC_SENSORS
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+#else
+    fwk_id_get_element_idx_ExpectAndReturn(element_id, 0);
+    mod_sensor_get_data_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+#endif
+
+    status = control_update(element_id);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(dev_ctx->emergency_tick_counter, 0);
+    TEST_ASSERT_FALSE(dev_ctx->control_read);
+#if THERMAL_HAS_ASYNC_SENSORS
+    TEST_ASSERT_TRUE(dev_ctx->read_pending);
+
+    /* A reading is already in progress: no new reading is started */
+    fwk_id_get_element_idx_ExpectAndReturn(element_id, 0);
+
+    status = control_update(element_id);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+#endif
+}
+
+void test_thermal_mgmt_thermal_update_emergency(void)
+{
+    int status;
+    unsigned int i;
+    struct perf_plugins_perf_update data;
+    struct mod_thermal_mgmt_dev_ctx *dev_ctx;
+    uint32_t level[FAKE_ACTOR_COUNT] = { 50, 50, 50, 50 };
+    uint32_t adj_max_limit[FAKE_ACTOR_COUNT] = { 50, 5, 50, 50 };
+
+    data.level = level;
+    data.adj_max_limit = adj_max_limit;
+
+    dev_ctx = &mod_ctx.dev_ctx_table[0];
+    dev_ctx->emergency_active = true;
+    dev_ctx->actor_ctx_table[0].emergency_perf_limit = 10;
+    dev_ctx->actor_ctx_table[1].emergency_perf_limit = 10;
+
+    for (i = 0; i < mod_ctx.dev_ctx_count; i++) {
+        fwk_id_t element_id =
+            FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_THERMAL_MGMT, i);
+
+        dev_ctx = &mod_ctx.dev_ctx_table[i];
+
+        fwk_id_get_element_idx_ExpectAndReturn(element_id, i);
+        fwk_id_get_element_idx_ExpectAndReturn(element_id, i);
+        distribute_power_Expect(dev_ctx->id, data.level, data.adj_max_limit);
+
+        if (i == 0) {
+            fwk_id_get_element_idx_ExpectAndReturn(
+                actor_table_domain0[0].dvfs_domain_id, FAKE_ACTOR_0);
+            fwk_id_get_element_idx_ExpectAndReturn(
+                actor_table_domain0[1].dvfs_domain_id, FAKE_ACTOR_1);
+        }
+    }
+
+    status = thermal_update(&data);
+    TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
+
+    /* Only the limits above the emergency limits are lowered */
+    TEST_ASSERT_EQUAL(adj_max_limit[FAKE_ACTOR_0], 10);
+    TEST_ASSERT_EQUAL(adj_max_limit[FAKE_ACTOR_1], 5);
+    TEST_ASSERT_EQUAL(adj_max_limit[FAKE_ACTOR_2], 50);
+    TEST_ASSERT_EQUAL(adj_max_limit[FAKE_ACTOR_3], 50);
+}
+
 void test_thermal_mgmt_thermal_update_success(void)
 {
     int status;
@@ -697,15 +1039,25 @@ int mod_thermal_mgmt_test_main(void)
     RUN_TEST(test_thermal_mgmt_bind_module);
     RUN_TEST(test_thermal_mgmt_bind_fail);
     RUN_TEST(test_thermal_mgmt_bind_success);
+    RUN_TEST(test_thermal_mgmt_bind_emergency);
 #if THERMAL_HAS_ASYNC_SENSORS
     RUN_TEST(test_thermal_mgmt_process_bind_request);
+    RUN_TEST(test_thermal_mgmt_process_bind_request_emergency);
     RUN_TEST(test_thermal_mgmt_process_event_invalid);
     RUN_TEST(test_thermal_mgmt_process_event_read_temp_pending);
     RUN_TEST(test_thermal_mgmt_process_event_read_temp_success);
     RUN_TEST(test_thermal_mgmt_process_event_read_request_fail);
     RUN_TEST(test_thermal_mgmt_process_event_read_request_success);
+    RUN_TEST(test_thermal_mgmt_process_event_emergency_trip);
+    RUN_TEST(test_thermal_mgmt_process_event_emergency_trip_fail);
+    RUN_TEST(test_thermal_mgmt_process_event_emergency_reading);
 #endif
 
+    RUN_TEST(test_thermal_mgmt_emergency_hysteresis);
+    RUN_TEST(test_thermal_mgmt_emergency_check_trip);
+    RUN_TEST(test_thermal_mgmt_emergency_precompute);
+    RUN_TEST(test_thermal_mgmt_dev_init_error_emergency);
+
     RUN_TEST(test_thermal_mgmt_thermal_protection);
 
 #if THERMAL_HAS_ASYNC_SENSORS
@@ -723,6 +1075,8 @@ int mod_thermal_mgmt_test_main(void)
     RUN_TEST(test_thermal_mgmt_control_update_fail_last_invalid_read);
     RUN_TEST(test_thermal_mgmt_control_update_last_success);
     RUN_TEST(test_thermal_mgmt_thermal_update_fail);
+    RUN_TEST(test_thermal_mgmt_control_update_emergency_check);
+    RUN_TEST(test_thermal_mgmt_thermal_update_emergency);
     RUN_TEST(test_thermal_mgmt_thermal_update_success);
 
     return UNITY_END();
@@ -11,6 +11,7 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
+#include <fwk_attributes.h>
 #include <fwk_dlist.h>
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
@@ -69,7 +70,7 @@ static struct timer_dev_ctx *ctx_table;
  * Forward declarations
  */
 
-static void timer_isr(uintptr_t ctx_ptr);
+static FWK_HOT void timer_isr(uintptr_t ctx_ptr);
 
 /*
  * Internal functions
@@ -533,7 +534,7 @@ static const struct mod_timer_alarm_api alarm_api = {
     .stop = alarm_stop,
 };
 
-static void timer_isr(uintptr_t ctx_ptr)
+static FWK_HOT void timer_isr(uintptr_t ctx_ptr)
 {
     int status;
     struct alarm_sub_element_ctx *alarm;
@@ -242,6 +242,19 @@ struct mod_transport_channel_config {
 
     /*! Identifier of the driver API to bind to */
     fwk_id_t driver_api_id;
+
+    /*!
+     * \brief Adaptive polling window in microseconds (optional).
+     *
+     * \details Time during which the driver is polled for a new message after
+     *      a response has been sent on a completer channel, before relying on
+     *      the doorbell interrupt again. Bursts of messages from an agent are
+     *      then handled back-to-back instead of taking an interrupt each. The
+     *      driver must implement ::mod_transport_driver_api::poll_event and
+     *      the firmware must provide a time driver, see ::fmw_time_driver.
+     *      Zero disables adaptive polling.
+     */
+    uint32_t adaptive_poll_window_us;
 };
 
 /*!
@@ -304,6 +317,21 @@ struct mod_transport_driver_api {
      */
     int (*trigger_event)(fwk_id_t device_id);
 
+    /*!
+     * \brief Poll the device for an incoming message (optional)
+     *
+     * \details A pending event is acknowledged by the driver so that its
+     *      interrupt is not taken.
+     *
+     * \param device_id Device identifier
+     * \param[out] pending \c true if an event was pending on the device.
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded
+     * \return One of the standard error codes for implementation-defined
+     *      errors
+     */
+    int (*poll_event)(fwk_id_t device_id, bool *pending);
+
 #ifdef BUILD_HAS_FAST_CHANNELS
     /*!
      * \brief Get fast channel address information.
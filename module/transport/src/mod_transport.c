@@ -32,6 +32,7 @@
 #include <fwk_notification.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#include <fwk_time.h>
 
 #include <stdbool.h>
 
@@ -222,6 +223,106 @@ static int transport_write_payload(
     return FWK_SUCCESS;
 }
 
+static int transport_get_response_buffer(
+    fwk_id_t channel_id,
+    void **payload,
+    size_t *size)
+{
+    struct transport_channel_ctx *channel_ctx;
+    struct mod_transport_buffer *buffer;
+
+    if ((payload == NULL) || (size == NULL)) {
+        fwk_unexpected();
+        return FWK_E_PARAM;
+    }
+
+    channel_ctx =
+        &transport_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    fwk_assert(
+        channel_ctx->config->transport_type !=
+        MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_NONE);
+
+    if (!channel_ctx->locked) {
+        return FWK_E_ACCESS;
+    }
+
+    /* Use internal write buffer for in-band messages */
+    buffer = channel_ctx->out;
+
+#if defined(BUILD_HAS_OUTBAND_MSG_SUPPORT)
+    if (channel_ctx->config->transport_type ==
+        MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND) {
+        /*
+         * The request payload has already been copied to the read buffer, so
+         * the response can be written straight to the shared mailbox.
+         */
+        buffer = ((struct mod_transport_buffer *)
+                      channel_ctx->config->out_band_mailbox_address);
+    }
+#endif
+
+    *payload = buffer->payload;
+    *size = channel_ctx->max_payload_size;
+
+    return FWK_SUCCESS;
+}
+
+static int transport_signal_message(fwk_id_t channel_id);
+
+/*
+ * Poll the driver for a while after a response has been sent, so that a
+ * message the agent sends straight away is handled without its interrupt.
+ */
+static void transport_adaptive_poll(struct transport_channel_ctx *channel_ctx)
+{
+    fwk_timestamp_t start;
+    fwk_duration_ns_t window;
+    unsigned int flags;
+    bool pending = false;
+    int status;
+
+    start = fwk_time_current();
+    window = FWK_US(channel_ctx->config->adaptive_poll_window_us);
+
+    do {
+        /*
+         * The doorbell interrupt may still be taken while polling. The
+         * interrupts are disabled so that the doorbell is not acknowledged
+         * once the interrupt handler has picked up the message.
+         */
+        flags = fwk_interrupt_global_disable();
+
+        if (channel_ctx->locked) {
+            /* The message has been picked up by the interrupt handler */
+            fwk_interrupt_global_enable(flags);
+            return;
+        }
+
+        status = channel_ctx->driver_api->poll_event(
+            channel_ctx->config->driver_id, &pending);
+
+        fwk_interrupt_global_enable(flags);
+
+        if (status != FWK_SUCCESS) {
+            return;
+        }
+
+        if (pending) {
+            /* Handled as if signalled by the driver interrupt handler */
+            status = transport_signal_message(channel_ctx->id);
+            if (status != FWK_SUCCESS) {
+                FWK_LOG_DEBUG(
+                    "%s Polled message on channel %u not handled",
+                    MOD_NAME,
+                    fwk_id_get_element_idx(channel_ctx->id));
+            }
+
+            return;
+        }
+    } while ((fwk_time_current() - start) < window);
+}
+
 static int transport_respond(
     fwk_id_t channel_id,
     const void *payload,
@@ -252,12 +353,14 @@ static int transport_respond(
 
         /*
          * Copy the payload from either the write buffer or the payload
-         * parameter.
+         * parameter, unless it has been built in the mailbox already.
          */
-        fwk_str_memcpy(
-            buffer->payload,
-            (payload == NULL ? channel_ctx->out->payload : payload),
-            size);
+        if (payload != buffer->payload) {
+            fwk_str_memcpy(
+                buffer->payload,
+                (payload == NULL ? channel_ctx->out->payload : payload),
+                size);
+        }
     }
 #else
 #    if defined(BUILD_HAS_INBAND_MSG_SUPPORT)
@@ -266,7 +369,7 @@ static int transport_respond(
         buffer = channel_ctx->out;
 
         /* Copy the payload from the payload parameter */
-        if (payload != NULL) {
+        if ((payload != NULL) && (payload != buffer->payload)) {
             fwk_str_memcpy(buffer->payload, payload, size);
         }
     }
@@ -311,6 +414,11 @@ static int transport_respond(
             channel_ctx->config->driver_id);
     }
 
+    if ((status == FWK_SUCCESS) &&
+        (channel_ctx->config->adaptive_poll_window_us != 0)) {
+        transport_adaptive_poll(channel_ctx);
+    }
+
     return status;
 }
 
@@ -453,6 +561,7 @@ static const struct mod_scmi_to_transport_api
         .get_message_header = transport_get_message_header,
         .get_payload = transport_get_payload,
         .write_payload = transport_write_payload,
+        .get_response_buffer = transport_get_response_buffer,
         .respond = transport_respond,
         .transmit = transport_transmit,
         .release_transport_channel_lock = transport_release_channel_lock,
@@ -947,6 +1056,22 @@ static int transport_bind(fwk_id_t id, unsigned int round)
         if (status != FWK_SUCCESS) {
             return status;
         }
+
+        /*
+         * Adaptive polling is only relevant on channels receiving requests,
+         * and its window is measured with the framework time.
+         */
+        if ((channel_ctx->config->adaptive_poll_window_us != 0) &&
+            ((channel_ctx->config->channel_type !=
+              MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER) ||
+             (channel_ctx->driver_api->poll_event == NULL) ||
+             (fwk_time_current() == FWK_NS(0)))) {
+            FWK_LOG_ERR(
+                "%s Adaptive polling not supported on channel %u",
+                MOD_NAME,
+                fwk_id_get_element_idx(id));
+            return FWK_E_DATA;
+        }
     }
 
     /* bind to module signal API */
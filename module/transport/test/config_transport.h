@@ -0,0 +1,40 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      Transport unit test configuration.
+ */
+
+#include <mod_transport.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+#define FAKE_PAYLOAD_SIZE 16
+
+/* Adaptive polling window of the completer channel */
+#define FAKE_POLL_WINDOW_US 10
+
+enum fake_transport_channel_idx {
+    FAKE_TRANSPORT_CHANNEL_IDX_COMPLETER,
+    FAKE_TRANSPORT_CHANNEL_IDX_COUNT,
+};
+
+struct fake_mailbox {
+    struct mod_transport_buffer buffer;
+    uint32_t payload[FAKE_PAYLOAD_SIZE / sizeof(uint32_t)];
+};
+
+static struct fake_mailbox fake_shared_mailbox;
+
+static struct mod_transport_channel_config fake_completer_config = {
+    .transport_type = MOD_TRANSPORT_CHANNEL_TRANSPORT_TYPE_OUT_BAND,
+    .channel_type = MOD_TRANSPORT_CHANNEL_TYPE_COMPLETER,
+    .out_band_mailbox_address = (uintptr_t)&fake_shared_mailbox,
+    .out_band_mailbox_size = sizeof(fake_shared_mailbox),
+    .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_DRIVER, 0),
+    .adaptive_poll_window_us = FAKE_POLL_WINDOW_US,
+};
@@ -0,0 +1,250 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+#include <fwk_time.h>
+
+#include UNIT_TEST_SRC
+
+#include <config_transport.h>
+
+#define FAKE_START_TIME FWK_US(100)
+
+static struct transport_channel_ctx
+    channel_ctx_table[FAKE_TRANSPORT_CHANNEL_IDX_COUNT];
+static struct transport_channel_ctx *const completer_ctx =
+    &channel_ctx_table[FAKE_TRANSPORT_CHANNEL_IDX_COMPLETER];
+
+static struct fake_mailbox in_buffer;
+static struct fake_mailbox out_buffer;
+
+static const uint32_t fake_response = 0xC0FFEE;
+
+/* Number of polls after which the driver reports a pending message */
+static unsigned int poll_event_pending_after;
+static unsigned int poll_event_count;
+static int poll_event_status;
+
+static unsigned int signal_message_count;
+
+static int fake_poll_event(fwk_id_t device_id, bool *pending)
+{
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(device_id, fake_completer_config.driver_id));
+
+    poll_event_count++;
+    *pending = (poll_event_count == poll_event_pending_after);
+
+    if (*pending) {
+        /* The agent has placed a new message in the shared mailbox */
+        fake_shared_mailbox.buffer.status &=
+            ~MOD_TRANSPORT_MAILBOX_STATUS_FREE_MASK;
+    }
+
+    return poll_event_status;
+}
+
+static int fake_trigger_event(fwk_id_t device_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_driver_api fake_driver_api = {
+    .trigger_event = fake_trigger_event,
+    .poll_event = fake_poll_event,
+};
+
+static int fake_signal_message(fwk_id_t service_id)
+{
+    signal_message_count++;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_signal_error(fwk_id_t service_id)
+{
+    return FWK_SUCCESS;
+}
+
+static struct mod_transport_firmware_signal_api fake_firmware_signal_api = {
+    .signal_message = fake_signal_message,
+    .signal_error = fake_signal_error,
+};
+
+void setUp(void)
+{
+    memset(channel_ctx_table, 0, sizeof(channel_ctx_table));
+    memset(&fake_shared_mailbox, 0, sizeof(fake_shared_mailbox));
+    memset(&in_buffer, 0, sizeof(in_buffer));
+    memset(&out_buffer, 0, sizeof(out_buffer));
+
+    transport_ctx.channel_ctx_table = channel_ctx_table;
+    transport_ctx.channel_count = FAKE_TRANSPORT_CHANNEL_IDX_COUNT;
+
+    completer_ctx->id = FWK_ID_ELEMENT(
+        FWK_MODULE_IDX_TRANSPORT, FAKE_TRANSPORT_CHANNEL_IDX_COMPLETER);
+    completer_ctx->config = &fake_completer_config;
+    completer_ctx->in = &in_buffer.buffer;
+    completer_ctx->out = &out_buffer.buffer;
+    completer_ctx->max_payload_size = FAKE_PAYLOAD_SIZE;
+    completer_ctx->service_id = FWK_ID_MODULE(FWK_MODULE_IDX_FAKE_SERVICE);
+    completer_ctx->driver_api = &fake_driver_api;
+    completer_ctx->transport_signal.firmware_signal_api =
+        &fake_firmware_signal_api;
+    completer_ctx->out_band_mailbox_ready = true;
+
+    /* A message is being processed, its response is about to be sent */
+    completer_ctx->locked = true;
+
+    poll_event_pending_after = 0;
+    poll_event_count = 0;
+    poll_event_status = FWK_SUCCESS;
+    signal_message_count = 0;
+}
+
+void tearDown(void)
+{
+    Mockfwk_time_Verify();
+    Mockfwk_time_Destroy();
+}
+
+static int respond(void)
+{
+    return transport_respond(
+        completer_ctx->id, &fake_response, sizeof(fake_response));
+}
+
+/*
+ * The next message is sent by the agent within the polling window, so it is
+ * handled without waiting for its interrupt.
+ */
+void test_transport_adaptive_poll_hit(void)
+{
+    int status;
+
+    poll_event_pending_after = 2;
+
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME);
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME + FWK_US(1));
+
+    status = respond();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2, poll_event_count);
+    TEST_ASSERT_EQUAL(1, signal_message_count);
+    TEST_ASSERT_TRUE(completer_ctx->locked);
+}
+
+/*
+ * No message is sent by the agent, the driver is polled until the window has
+ * elapsed.
+ */
+void test_transport_adaptive_poll_miss(void)
+{
+    int status;
+
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME);
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME + FWK_US(1));
+    fwk_time_current_ExpectAndReturn(
+        FAKE_START_TIME + FWK_US(FAKE_POLL_WINDOW_US - 1));
+    fwk_time_current_ExpectAndReturn(
+        FAKE_START_TIME + FWK_US(FAKE_POLL_WINDOW_US));
+
+    status = respond();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(3, poll_event_count);
+    TEST_ASSERT_EQUAL(0, signal_message_count);
+    TEST_ASSERT_FALSE(completer_ctx->locked);
+}
+
+/*
+ * The interrupt handler has picked up the next message, the driver is not
+ * polled anymore.
+ */
+void test_transport_adaptive_poll_locked(void)
+{
+    completer_ctx->locked = true;
+
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME);
+
+    transport_adaptive_poll(completer_ctx);
+
+    TEST_ASSERT_EQUAL(0, poll_event_count);
+    TEST_ASSERT_EQUAL(0, signal_message_count);
+}
+
+/*
+ * A polled message is discarded like a signalled one when the out-band mailbox
+ * is not ready.
+ */
+void test_transport_adaptive_poll_out_band_not_ready(void)
+{
+    int status;
+
+    poll_event_pending_after = 1;
+    completer_ctx->out_band_mailbox_ready = false;
+
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME);
+
+    status = respond();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, poll_event_count);
+    TEST_ASSERT_EQUAL(0, signal_message_count);
+    TEST_ASSERT_FALSE(completer_ctx->locked);
+}
+
+/* The driver fails to report the event status, polling is stopped */
+void test_transport_adaptive_poll_driver_error(void)
+{
+    int status;
+
+    poll_event_status = FWK_E_DEVICE;
+
+    fwk_time_current_ExpectAndReturn(FAKE_START_TIME);
+
+    status = respond();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, poll_event_count);
+    TEST_ASSERT_EQUAL(0, signal_message_count);
+}
+
+int transport_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_transport_adaptive_poll_hit);
+    RUN_TEST(test_transport_adaptive_poll_miss);
+    RUN_TEST(test_transport_adaptive_poll_locked);
+    RUN_TEST(test_transport_adaptive_poll_out_band_not_ready);
+    RUN_TEST(test_transport_adaptive_poll_driver_error);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return transport_test_main();
+}
+#endif
@@ -10,4 +10,6 @@ set(SCP_FIRMWARE_TARGET "host")
 
 set(SCP_ARCHITECTURE "none")
 
+set(SCP_ENABLE_MMIO_TRACING_INIT FALSE)
+
 list(APPEND SCP_MODULES "stdio")
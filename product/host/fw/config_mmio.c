@@ -0,0 +1,108 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     Host MMIO driver, backing the registers with a simulated memory and
+ *     recording the accesses in a trace buffer.
+ */
+
+#include <fwk_assert.h>
+#include <fwk_mmio.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of registers the simulated memory can hold */
+#define HOST_MMIO_REG_COUNT 256
+
+/* Number of accesses kept in the trace buffer */
+#define HOST_MMIO_TRACE_LENGTH 512
+
+struct host_mmio_reg {
+    volatile const void *addr;
+    uint32_t value;
+};
+
+struct host_mmio_trace_entry {
+    uint32_t module_idx;
+    volatile const void *addr;
+    uint32_t value;
+    bool write;
+};
+
+static struct {
+    /* Registers written so far, the others read as zero */
+    struct host_mmio_reg regs[HOST_MMIO_REG_COUNT];
+    unsigned int reg_count;
+
+    /* Last accesses, the oldest ones being overwritten */
+    struct host_mmio_trace_entry trace[HOST_MMIO_TRACE_LENGTH];
+    unsigned int trace_count;
+} host_mmio_ctx;
+
+static struct host_mmio_reg *host_mmio_find_reg(volatile const void *addr)
+{
+    unsigned int reg_idx;
+
+    for (reg_idx = 0; reg_idx < host_mmio_ctx.reg_count; reg_idx++) {
+        if (host_mmio_ctx.regs[reg_idx].addr == addr) {
+            return &host_mmio_ctx.regs[reg_idx];
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t host_mmio_read32(volatile const void *addr)
+{
+    const struct host_mmio_reg *reg = host_mmio_find_reg(addr);
+
+    return (reg == NULL) ? 0 : reg->value;
+}
+
+static void host_mmio_write32(volatile void *addr, uint32_t value)
+{
+    struct host_mmio_reg *reg = host_mmio_find_reg(addr);
+
+    if (reg == NULL) {
+        fwk_assert(host_mmio_ctx.reg_count < HOST_MMIO_REG_COUNT);
+        if (host_mmio_ctx.reg_count >= HOST_MMIO_REG_COUNT) {
+            return;
+        }
+
+        reg = &host_mmio_ctx.regs[host_mmio_ctx.reg_count++];
+        reg->addr = addr;
+    }
+
+    reg->value = value;
+}
+
+static void host_mmio_report_access(
+    uint32_t module_idx,
+    volatile const void *addr,
+    uint32_t value,
+    bool write)
+{
+    struct host_mmio_trace_entry *entry;
+
+    entry = &host_mmio_ctx.trace
+                 [host_mmio_ctx.trace_count++ % HOST_MMIO_TRACE_LENGTH];
+
+    entry->module_idx = module_idx;
+    entry->addr = addr;
+    entry->value = value;
+    entry->write = write;
+}
+
+struct fwk_mmio_driver fmw_mmio_driver(void)
+{
+    return (struct fwk_mmio_driver){
+        .read32 = host_mmio_read32,
+        .write32 = host_mmio_write32,
+        .report_access = host_mmio_report_access,
+    };
+}
@@ -189,6 +189,35 @@ static int smt_write_payload(
     return FWK_SUCCESS;
 }
 
+static int smt_get_response_buffer(
+    fwk_id_t channel_id,
+    void **payload,
+    size_t *size)
+{
+    struct smt_channel_ctx *channel_ctx;
+    struct mod_optee_smt_memory *memory;
+
+    if ((payload == NULL) || (size == NULL)) {
+        fwk_unexpected();
+        return FWK_E_PARAM;
+    }
+
+    channel_ctx =
+        &smt_ctx.channel_ctx_table[fwk_id_get_element_idx(channel_id)];
+
+    if (!channel_ctx->locked) {
+        return FWK_E_ACCESS;
+    }
+
+    /* The request payload lives in the read buffer, the mailbox is free */
+    memory = (struct mod_optee_smt_memory *)channel_ctx->mailbox_va;
+
+    *payload = memory->payload;
+    *size = channel_ctx->max_payload_size;
+
+    return FWK_SUCCESS;
+}
+
 static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
 {
     struct smt_channel_ctx *channel_ctx;
@@ -201,11 +230,16 @@ static int smt_respond(fwk_id_t channel_id, const void *payload, size_t size)
     /* Copy the header from the write buffer */
     *memory = *channel_ctx->out;
 
-    /* Copy the payload from either the write buffer or the payload parameter */
-    fwk_str_memcpy(
-        memory->payload,
-        (payload == NULL ? channel_ctx->out->payload : payload),
-        size);
+    /*
+     * Copy the payload from either the write buffer or the payload parameter,
+     * unless it has been built in the mailbox already.
+     */
+    if (payload != memory->payload) {
+        fwk_str_memcpy(
+            memory->payload,
+            (payload == NULL ? channel_ctx->out->payload : payload),
+            size);
+    }
 
     channel_ctx->locked = false;
 
@@ -268,6 +302,7 @@ static const struct mod_scmi_to_transport_api smt_mod_scmi_to_transport_api = {
     .get_message_header = smt_get_message_header,
     .get_payload = smt_get_payload,
     .write_payload = smt_write_payload,
+    .get_response_buffer = smt_get_response_buffer,
     .respond = smt_respond,
     .transmit = smt_transmit,
 };